@@ -58,7 +58,8 @@ void UpdateChangelistHistory(TUniquePtr<FRepState>& RepState)
 		// All active history items should contain a change list
 		check(HistoryItem.Changed.Num() > 0);
 
-		HistoryItem.Changed.Empty();
+		// Keep the allocation, the item will be reused for a later changelist.
+		HistoryItem.Changed.Reset();
 		HistoryItem.OutPacketIdRange = FPacketIdRange();
 		RepState->HistoryStart++;
 	}
@@ -77,12 +78,18 @@ USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectIniti
 	: Super(ObjectInitializer)
 	, bCreatedEntity(false)
 	, bCreatingNewEntity(false)
+	, bComponentInterestDirty(true)
 	, EntityId(SpatialConstants::INVALID_ENTITY_ID)
 	, bInterestDirty(false)
 	, bNetOwned(false)
 	, NetDriver(nullptr)
 	, LastPositionSinceUpdate(FVector::ZeroVector)
 	, TimeWhenPositionLastUpdated(0.0f)
+	, bPositionHierarchyDirty(true)
+	, bPositionHierarchyHasUnresolvedEntities(true)
+	, ActorHandoverShadowData(nullptr)
+	, ReplicationBytesWritten(0)
+	, bHandoverSubobjectsDirty(true)
 {
 }
 
@@ -169,6 +176,13 @@ bool USpatialActorChannel::CleanUp(const bool bForDestroy, EChannelCloseReason C
 	// Must cleanup actor and subobjects before UActorChannel::Cleanup as it will clear CreateSubObjects
 	Receiver->CleanupDeletedEntity(EntityId);
 
+	if (NetDriver != nullptr && Actor != nullptr)
+	{
+		NetDriver->ActorGrid.RemoveActor(Actor);
+	}
+
+	ReleaseHandoverShadowData();
+
 #if ENGINE_MINOR_VERSION <= 20
 	return UActorChannel::CleanUp(bForDestroy);
 #else
@@ -223,6 +237,18 @@ void USpatialActorChannel::UpdateShadowData()
 	}
 }
 
+void USpatialActorChannel::QueueSpatialPositionUpdate()
+{
+	if (GetDefault<USpatialGDKSettings>()->bBatchSpatialPositionUpdates)
+	{
+		Sender->RegisterChannelForPositionUpdate(this);
+	}
+	else
+	{
+		UpdateSpatialPositionWithFrequencyCheck();
+	}
+}
+
 void USpatialActorChannel::UpdateSpatialPositionWithFrequencyCheck()
 {
 	// Check that there has been a sufficient amount of time since the last update.
@@ -314,6 +340,7 @@ int64 USpatialActorChannel::ReplicateActor()
 	}
 
 	bIsReplicatingActor = true;
+	ReplicationBytesWritten = 0;
 	FReplicationFlags RepFlags;
 
 	// Send initial stuff.
@@ -360,14 +387,7 @@ int64 USpatialActorChannel::ReplicateActor()
 	// Update SpatialOS position.
 	if (!bCreatingNewEntity)
 	{
-		if (GetDefault<USpatialGDKSettings>()->bBatchSpatialPositionUpdates)
-		{
-			Sender->RegisterChannelForPositionUpdate(this);
-		}
-		else
-		{
-			UpdateSpatialPositionWithFrequencyCheck();
-		}
+		QueueSpatialPositionUpdate();
 	}
 	
 	// Update the replicated property change list.
@@ -382,17 +402,20 @@ int64 USpatialActorChannel::ReplicateActor()
 	const int32 PossibleNewHistoryIndex = ActorReplicator->RepState->HistoryEnd % FRepState::MAX_CHANGE_HISTORY;
 	FRepChangedHistory& PossibleNewHistoryItem = ActorReplicator->RepState->ChangeHistory[PossibleNewHistoryIndex];
 	TArray<uint16>& RepChanged = PossibleNewHistoryItem.Changed;
+	TArray<uint16>& MergeScratch = NetDriver->ChangelistMergeScratch;
 
 	// Gather all change lists that are new since we last looked, and merge them all together into a single CL
 	for (int32 i = ActorReplicator->RepState->LastChangelistIndex; i < ChangelistState->HistoryEnd; i++)
 	{
 		const int32 HistoryIndex = i % FRepChangelistState::MAX_CHANGE_HISTORY;
 		FRepChangedHistory& HistoryItem = ChangelistState->ChangeHistory[HistoryIndex];
-		TArray<uint16> Temp = RepChanged;
 
 		if (HistoryItem.Changed.Num() > 0)
 		{
-			ActorReplicator->RepLayout->MergeChangeList((uint8*)Actor, HistoryItem.Changed, Temp, RepChanged);
+			// Merge into the scratch buffer and swap it with RepChanged, rather than copying RepChanged for every history item.
+			MergeScratch.Reset();
+			ActorReplicator->RepLayout->MergeChangeList((uint8*)Actor, HistoryItem.Changed, RepChanged, MergeScratch);
+			Exchange(RepChanged, MergeScratch);
 		}
 		else
 		{
@@ -408,7 +431,17 @@ int64 USpatialActorChannel::ReplicateActor()
 
 	if (ActorHandoverShadowData != nullptr)
 	{
-		HandoverChangeState = GetHandoverChangeList(*ActorHandoverShadowData, Actor);
+		HandoverChangeState = GetHandoverChangeList(ActorHandoverShadowData, Actor, Info);
+	}
+
+	if (PendingActorHandoverChanges.Num() > 0)
+	{
+		for (uint16 Handle : PendingActorHandoverChanges)
+		{
+			HandoverChangeState.AddUnique(Handle);
+		}
+		HandoverChangeState.Sort();
+		PendingActorHandoverChanges.Reset();
 	}
 
 	// If any properties have changed, send a component update.
@@ -420,7 +453,7 @@ int64 USpatialActorChannel::ReplicateActor()
 			// so we know what subobjects are relevant for replication when creating the entity.
 			Actor->ReplicateSubobjects(this, &Bunch, &RepFlags);
 
-			Sender->SendCreateEntityRequest(this);
+			ReplicationBytesWritten += Sender->SendCreateEntityRequest(this);
 
 			// Since we've tried to create this Actor in Spatial, we no longer have authority over the actor since it hasn't been delegated to us.
 			Actor->Role = ROLE_SimulatedProxy;
@@ -429,7 +462,7 @@ int64 USpatialActorChannel::ReplicateActor()
 		else
 		{
 			FRepChangeState RepChangeState = { RepChanged, GetObjectRepLayout(Actor) };
-			Sender->SendComponentUpdates(Actor, Info, this, &RepChangeState, &HandoverChangeState);
+			ReplicationBytesWritten += Sender->SendComponentUpdates(Actor, Info, this, &RepChangeState, &HandoverChangeState);
 			bInterestDirty = false;
 		}
 
@@ -458,24 +491,29 @@ int64 USpatialActorChannel::ReplicateActor()
 		// the same SpatialActorChannel::ReplicateSubobject.
 		bWroteSomethingImportant |= Actor->ReplicateSubobjects(this, &DummyOutBunch, &RepFlags);
 
-		for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+		for (const auto& SubobjectInfoPair : GetHandoverSubobjects())
 		{
-			UObject* Subobject = SubobjectInfoPair.Key;
+			UObject* Subobject = SubobjectInfoPair.Key.Get();
+			if (Subobject == nullptr)
+			{
+				continue;
+			}
+
 			const FClassInfo& SubobjectInfo = *SubobjectInfoPair.Value;
 
 			// Handover shadow data should already exist for this object. If it doesn't, it must have
 			// started replicating after SetChannelActor was called on the owning actor.
-			TSharedRef<TArray<uint8>>* SubobjectHandoverShadowData = HandoverShadowDataMap.Find(Subobject);
+			const FHandoverShadowData* SubobjectHandoverShadowData = HandoverShadowDataMap.Find(Subobject);
 			if (SubobjectHandoverShadowData == nullptr)
 			{
 				UE_LOG(LogSpatialActorChannel, Warning, TEXT("EntityId: %lld Actor: %s HandoverShadowData not found for Subobject %s"), EntityId, *Actor->GetName(), *Subobject->GetName());
 				continue;
 			}
 
-			FHandoverChangeState SubobjectHandoverChangeState = GetHandoverChangeList(SubobjectHandoverShadowData->Get(), Subobject);
+			FHandoverChangeState SubobjectHandoverChangeState = GetHandoverChangeList(SubobjectHandoverShadowData->Data, Subobject, SubobjectInfo);
 			if (SubobjectHandoverChangeState.Num() > 0)
 			{
-				Sender->SendComponentUpdates(Subobject, SubobjectInfo, this, nullptr, &SubobjectHandoverChangeState);
+				ReplicationBytesWritten += Sender->SendComponentUpdates(Subobject, SubobjectInfo, this, nullptr, &SubobjectHandoverChangeState);
 			}
 		}
 
@@ -496,6 +534,7 @@ int64 USpatialActorChannel::ReplicateActor()
 
 				RepComp.Value()->CleanUp();
 				RepComp.RemoveCurrent();
+				bHandoverSubobjectsDirty = true;
 			}
 		}
 	}
@@ -509,11 +548,57 @@ int64 USpatialActorChannel::ReplicateActor()
 
 	bForceCompareProperties = false;		// Only do this once per frame when set
 
-	return (bWroteSomethingImportant) ? 1 : 0;	// TODO: return number of bits written (UNR-664)
+	// Return the number of bits written, as Unreal does. Updates that were only queued (e.g. waiting on unresolved references) still count as written.
+	return (bWroteSomethingImportant) ? FMath::Max<int64>(ReplicationBytesWritten * 8, 1) : 0;
+}
+
+bool USpatialActorChannel::CanCompareProperties()
+{
+	return Actor != nullptr && !Closing && !bCreatingNewEntity && !bForceCompareProperties && ActorReplicator && IsReadyForReplication();
+}
+
+void USpatialActorChannel::CompareProperties(const FClassInfo& Info)
+{
+	const UWorld* const ActorWorld = Actor->GetWorld();
+
+	// Matches the flags ReplicateActor uses for an entity that has already been created.
+	FReplicationFlags RepFlags;
+	RepFlags.bNetOwner = true;
+	RepFlags.bNetSimulated = (Actor->GetRemoteRole() == ROLE_SimulatedProxy);
+	RepFlags.bRepPhysics = Actor->ReplicatedMovement.bRepPhysics;
+	RepFlags.bReplay = ActorWorld && (ActorWorld->DemoNetDriver == Connection->GetDriver());
+
+	// Updating the changelist manager records the replication frame it compared in, so the calls made
+	// from ReplicateActor and ReplicateSubobject later this frame reuse the result instead of comparing again.
+	for (auto& ReplicatorPair : ReplicationMap)
+	{
+		FObjectReplicator& Replicator = ReplicatorPair.Value.Get();
+		UObject* Object = Replicator.GetObject();
+		if (Object == nullptr || !Replicator.ChangelistMgr.IsValid() || !Replicator.RepState.IsValid())
+		{
+			continue;
+		}
+
+#if ENGINE_MINOR_VERSION <= 20
+		Replicator.ChangelistMgr->Update(Object, Connection->Driver->ReplicationFrame, Replicator.RepState->LastCompareIndex, RepFlags, false);
+#else
+		Replicator.ChangelistMgr->Update(Replicator.RepState.Get(), Object, Connection->Driver->ReplicationFrame, RepFlags, false);
+#endif
+	}
+
+	if (ActorHandoverShadowData != nullptr)
+	{
+		for (uint16 Handle : GetHandoverChangeList(ActorHandoverShadowData, Actor, Info))
+		{
+			PendingActorHandoverChanges.AddUnique(Handle);
+		}
+	}
 }
 
 void USpatialActorChannel::DynamicallyAttachSubobject(UObject* Object)
 {
+	bHandoverSubobjectsDirty = true;
+
 	// Find out if this is a dynamic subobject or a subobject that is already attached but is now replicated
 	FUnrealObjectRef ObjectRef = NetDriver->PackageMap->GetUnrealObjectRefFromObject(Object);
 
@@ -643,17 +728,19 @@ bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicatio
 	const int32 PossibleNewHistoryIndex = Replicator.RepState->HistoryEnd % FRepState::MAX_CHANGE_HISTORY;
 	FRepChangedHistory& PossibleNewHistoryItem = Replicator.RepState->ChangeHistory[PossibleNewHistoryIndex];
 	TArray<uint16>& RepChanged = PossibleNewHistoryItem.Changed;
+	TArray<uint16>& MergeScratch = NetDriver->ChangelistMergeScratch;
 
 	// Gather all change lists that are new since we last looked, and merge them all together into a single CL
 	for (int32 i = Replicator.RepState->LastChangelistIndex; i < ChangelistState->HistoryEnd; i++)
 	{
 		const int32 HistoryIndex = i % FRepChangelistState::MAX_CHANGE_HISTORY;
 		FRepChangedHistory& HistoryItem = ChangelistState->ChangeHistory[HistoryIndex];
-		TArray<uint16> Temp = RepChanged;
 
 		if (HistoryItem.Changed.Num() > 0)
 		{
-			Replicator.RepLayout->MergeChangeList((uint8*)Object, HistoryItem.Changed, Temp, RepChanged);
+			MergeScratch.Reset();
+			Replicator.RepLayout->MergeChangeList((uint8*)Object, HistoryItem.Changed, RepChanged, MergeScratch);
+			Exchange(RepChanged, MergeScratch);
 		}
 		else
 		{
@@ -675,7 +762,7 @@ bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicatio
 		}
 		
 		const FClassInfo& Info = NetDriver->ClassInfoManager->GetOrCreateClassInfoByObject(Object);
-		Sender->SendComponentUpdates(Object, Info, this, &RepChangeState, nullptr);
+		ReplicationBytesWritten += Sender->SendComponentUpdates(Object, Info, this, &RepChangeState, nullptr);
 
 		Replicator.RepState->HistoryEnd++;
 	}
@@ -692,11 +779,17 @@ bool USpatialActorChannel::ReplicateSubobject(UObject* Obj, FOutBunch& Bunch, co
 	return ReplicateSubobject(Obj, RepFlags);
 }
 
-TMap<UObject*, const FClassInfo*> USpatialActorChannel::GetHandoverSubobjects()
+const TArray<TPair<TWeakObjectPtr<UObject>, const FClassInfo*>>& USpatialActorChannel::GetHandoverSubobjects()
 {
+	if (!bHandoverSubobjectsDirty)
+	{
+		return CachedHandoverSubobjects;
+	}
+
 	const FClassInfo& Info = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Actor->GetClass());
 
-	TMap<UObject*, const FClassInfo*> FoundSubobjects;
+	CachedHandoverSubobjects.Reset();
+	bHandoverSubobjectsDirty = false;
 
 	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 	{
@@ -721,62 +814,82 @@ TMap<UObject*, const FClassInfo*> USpatialActorChannel::GetHandoverSubobjects()
 
 		if (Object == nullptr)
 		{
+			// Try again next time, the subobject may not have been resolved yet.
+			bHandoverSubobjectsDirty = true;
 			continue;
 		}
 
-		FoundSubobjects.Add(Object, &SubobjectInfo);
+		CachedHandoverSubobjects.Emplace(Object, &SubobjectInfo);
 	}
 
-	return FoundSubobjects;
+	return CachedHandoverSubobjects;
 }
 
-void USpatialActorChannel::InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object)
+void USpatialActorChannel::InitializeHandoverShadowData(UObject* Object, const FClassInfo& Info)
 {
-	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+	check(!HandoverShadowDataMap.Contains(Object));
 
-	uint32 Size = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+	const FHandoverShadowData& ShadowData = HandoverShadowDataMap.Add(Object, NetDriver->AllocateHandoverShadowData(Info));
+	if (Object == Actor)
 	{
-		if (PropertyInfo.ArrayIdx == 0) // For static arrays, the first element will handle the whole array
-		{
-			// Make sure we conform to Unreal's alignment requirements; this is matched below and in ReplicateActor()
-			Size = Align(Size, PropertyInfo.Property->GetMinAlignment());
-			Size += PropertyInfo.Property->GetSize();
-		}
+		ActorHandoverShadowData = ShadowData.Data;
 	}
-	ShadowData.AddZeroed(Size);
-	uint32 Offset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+}
+
+void USpatialActorChannel::ReleaseHandoverShadowData()
+{
+	for (auto& ShadowDataPair : HandoverShadowDataMap)
 	{
-		if (PropertyInfo.ArrayIdx == 0)
-		{
-			Offset = Align(Offset, PropertyInfo.Property->GetMinAlignment());
-			PropertyInfo.Property->InitializeValue(ShadowData.GetData() + Offset);
-			Offset += PropertyInfo.Property->GetSize();
-		}
+		ShadowDataPair.Value.Arena->Free(ShadowDataPair.Value.Slot);
 	}
+
+	HandoverShadowDataMap.Empty();
+	ActorHandoverShadowData = nullptr;
+	PendingActorHandoverChanges.Reset();
 }
 
-FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object)
+FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(uint8* ShadowData, UObject* Object, const FClassInfo& ClassInfo)
 {
 	FHandoverChangeState HandoverChanged;
 
-	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+	const uint8* ObjectData = (uint8*)Object;
 
-	uint32 ShadowDataOffset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+	for (const FHandoverShadowSpan& Span : ClassInfo.HandoverShadowSpans)
 	{
-		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
+		if (Span.bMemoryComparable)
+		{
+			// Compare every property in the span at once, and only look at them individually if something changed.
+			if (!bCreatingNewEntity && FMemory::Memcmp(ShadowData + Span.ShadowOffset, ObjectData + Span.Offset, Span.Size) == 0)
+			{
+				continue;
+			}
+
+			for (int32 i = Span.FirstProperty; i < Span.FirstProperty + Span.NumProperties; i++)
+			{
+				const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[i];
+				const int32 Size = PropertyInfo.Property->ElementSize;
+				uint8* StoredData = ShadowData + PropertyInfo.ShadowOffset;
+				const uint8* Data = ObjectData + PropertyInfo.Offset;
+
+				if (bCreatingNewEntity || FMemory::Memcmp(StoredData, Data, Size) != 0)
+				{
+					HandoverChanged.Add(PropertyInfo.Handle);
+					FMemory::Memcpy(StoredData, Data, Size);
+				}
+			}
+			continue;
+		}
+
+		const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[Span.FirstProperty];
+		uint8* StoredData = ShadowData + PropertyInfo.ShadowOffset;
+		const uint8* Data = ObjectData + PropertyInfo.Offset;
 
-		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
-		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
 		// Compare and assign.
 		if (bCreatingNewEntity || !PropertyInfo.Property->Identical(StoredData, Data))
 		{
 			HandoverChanged.Add(PropertyInfo.Handle);
 			PropertyInfo.Property->CopySingleValue(StoredData, Data);
 		}
-		ShadowDataOffset += PropertyInfo.Property->ElementSize;
 	}
 
 	return HandoverChanged;
@@ -808,22 +921,16 @@ void USpatialActorChannel::SetChannelActor(AActor* InActor)
 	}
 
 	// Set up the shadow data for the handover properties. This is used later to compare the properties and send only changed ones.
-	check(!HandoverShadowDataMap.Contains(InActor));
-
-	// Create the shadow map, and store a quick access pointer to it
 	const FClassInfo& Info = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(InActor->GetClass());
 	if (Info.SchemaComponents[SCHEMA_Handover] != SpatialConstants::INVALID_COMPONENT_ID)
 	{
-		ActorHandoverShadowData = &HandoverShadowDataMap.Add(InActor, MakeShared<TArray<uint8>>()).Get();
-		InitializeHandoverShadowData(*ActorHandoverShadowData, InActor);
+		InitializeHandoverShadowData(InActor, Info);
 	}
 
-	for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+	bHandoverSubobjectsDirty = true;
+	for (const auto& SubobjectInfoPair : GetHandoverSubobjects())
 	{
-		UObject* Subobject = SubobjectInfoPair.Key;
-
-		check(!HandoverShadowDataMap.Contains(Subobject));
-		InitializeHandoverShadowData(HandoverShadowDataMap.Add(Subobject, MakeShared<TArray<uint8>>()).Get(), Subobject);
+		InitializeHandoverShadowData(SubobjectInfoPair.Key.Get(), *SubobjectInfoPair.Value);
 	}
 
 	SavedOwnerWorkerAttribute = SpatialGDK::GetOwnerWorkerAttribute(InActor);
@@ -837,6 +944,9 @@ bool USpatialActorChannel::TryResolveActor()
 	{
 		return false;
 	}
+
+	// Subobjects are now resolved through the package map.
+	bHandoverSubobjectsDirty = true;
 	
 	// If a Singleton was created, update the GSM with the proper Id.
 	if (Actor->GetClass()->HasAnySpatialClassFlags(SPATIALCLASS_Singleton))
@@ -941,9 +1051,8 @@ void USpatialActorChannel::UpdateSpatialPosition()
 	}
 
 	// Check that the Actor has moved sufficiently far to be updated
-	const float SpatialPositionThresholdSquared = FMath::Square(GetDefault<USpatialGDKSettings>()->PositionDistanceThreshold);
 	FVector ActorSpatialPosition = GetActorSpatialPosition(Actor);
-	if (FVector::DistSquared(ActorSpatialPosition, LastPositionSinceUpdate) < SpatialPositionThresholdSquared)
+	if (FVector::DistSquared(ActorSpatialPosition, LastPositionSinceUpdate) < NetDriver->GetPositionDistanceThresholdSquared())
 	{
 		return;
 	}
@@ -951,27 +1060,108 @@ void USpatialActorChannel::UpdateSpatialPosition()
 	LastPositionSinceUpdate = ActorSpatialPosition;
 	TimeWhenPositionLastUpdated = NetDriver->Time;
 
-	SendPositionUpdate(Actor, EntityId, LastPositionSinceUpdate);
+	SendPositionUpdates(LastPositionSinceUpdate);
+}
+
+void USpatialActorChannel::SendPositionUpdates(const FVector& NewPosition)
+{
+	if (!IsPositionHierarchyValid())
+	{
+		RebuildPositionHierarchy();
+	}
+
+	const bool bUseReplicationGrid = GetDefault<USpatialGDKSettings>()->bUseReplicationGrid;
+
+	for (const FPositionHierarchyEntry& Entry : PositionHierarchy)
+	{
+		AActor* EntryActor = Entry.Actor.Get();
+		if (EntryActor == nullptr)
+		{
+			continue;
+		}
+
+		if (bUseReplicationGrid)
+		{
+			NetDriver->ActorGrid.UpdateActor(EntryActor, NewPosition);
+		}
+
+		if (Entry.EntityId != SpatialConstants::INVALID_ENTITY_ID && NetDriver->StaticComponentView->HasAuthority(Entry.EntityId, SpatialConstants::POSITION_COMPONENT_ID))
+		{
+			Sender->SendPositionUpdate(Entry.EntityId, NewPosition);
+		}
+	}
+}
+
+bool USpatialActorChannel::IsPositionHierarchyValid() const
+{
+	if (PositionHierarchy.Num() == 0 || bPositionHierarchyHasUnresolvedEntities || bPositionHierarchyDirty)
+	{
+		return false;
+	}
+
+	// A PlayerController also updates the position of its Pawn, which it may not own.
+	if (const APlayerController* PlayerController = Cast<APlayerController>(Actor))
+	{
+		if (PlayerController->GetPawn() != PositionHierarchyPawn.Get())
+		{
+			return false;
+		}
+	}
+
+	// Catch Actors leaving the hierarchy, and Children changing without going through USpatialNetDriver::OnOwnerUpdated.
+	for (const FPositionHierarchyEntry& Entry : PositionHierarchy)
+	{
+		const AActor* EntryActor = Entry.Actor.Get();
+		if (EntryActor == nullptr || EntryActor->GetOwner() != Entry.Owner.Get() || EntryActor->Children.Num() != Entry.NumChildren)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void USpatialActorChannel::RebuildPositionHierarchy()
+{
+	PositionHierarchy.Reset();
+	PositionHierarchyPawn = nullptr;
+	bPositionHierarchyHasUnresolvedEntities = false;
+	bPositionHierarchyDirty = false;
+
+	AddToPositionHierarchy(Actor);
 
 	if (APlayerController* PlayerController = Cast<APlayerController>(Actor))
 	{
-		if (APawn* Pawn = PlayerController->GetPawn())
+		PositionHierarchyPawn = PlayerController->GetPawn();
+
+		// The Pawn is usually owned by the PlayerController, in which case it was added above.
+		if (APawn* Pawn = PositionHierarchyPawn.Get())
 		{
-			SendPositionUpdate(Pawn, NetDriver->PackageMap->GetEntityIdFromObject(Pawn), LastPositionSinceUpdate);
+			if (!PositionHierarchy.ContainsByPredicate([Pawn](const FPositionHierarchyEntry& Entry) { return Entry.Actor == Pawn; }))
+			{
+				AddToPositionHierarchy(Pawn);
+			}
 		}
 	}
 }
 
-void USpatialActorChannel::SendPositionUpdate(AActor* InActor, Worker_EntityId InEntityId, const FVector& NewPosition)
+void USpatialActorChannel::AddToPositionHierarchy(AActor* InActor)
 {
-	if (InEntityId != SpatialConstants::INVALID_ENTITY_ID && NetDriver->StaticComponentView->HasAuthority(InEntityId, SpatialConstants::POSITION_COMPONENT_ID))
+	const Worker_EntityId InEntityId = (InActor == Actor) ? EntityId : NetDriver->PackageMap->GetEntityIdFromObject(InActor);
+	if (InEntityId == SpatialConstants::INVALID_ENTITY_ID && InActor->GetIsReplicated())
 	{
-		Sender->SendPositionUpdate(InEntityId, NewPosition);
+		// Retry on the next update, the entity may not have been created yet.
+		bPositionHierarchyHasUnresolvedEntities = true;
 	}
 
-	for (const auto& Child : InActor->Children)
+	PositionHierarchy.Add({ InActor, InEntityId, InActor->Children.Num(), InActor->GetOwner() });
+
+	for (AActor* Child : InActor->Children)
 	{
-		SendPositionUpdate(Child, NetDriver->PackageMap->GetEntityIdFromObject(Child), NewPosition);
+		if (Child != nullptr)
+		{
+			AddToPositionHierarchy(Child);
+		}
 	}
 }
 
@@ -1028,24 +1218,15 @@ void USpatialActorChannel::RemoveRepNotifiesWithUnresolvedObjs(TArray<UProperty*
 	});
 }
 
-void USpatialActorChannel::ServerProcessOwnershipChange()
+bool USpatialActorChannel::ServerProcessOwnershipChange()
 {
 	if (!IsAuthoritativeServer())
 	{
-		return;
+		return false;
 	}
 
 	UpdateEntityACLToNewOwner();
-
-	for (AActor* Child : Actor->Children)
-	{
-		Worker_EntityId ChildEntityId = NetDriver->PackageMap->GetEntityIdFromObject(Child);
-
-		if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(ChildEntityId))
-		{
-			Channel->ServerProcessOwnershipChange();
-		}
-	}
+	return true;
 }
 
 void USpatialActorChannel::UpdateEntityACLToNewOwner()
@@ -1054,6 +1235,15 @@ void USpatialActorChannel::UpdateEntityACLToNewOwner()
 
 	if (SavedOwnerWorkerAttribute != NewOwnerWorkerAttribute)
 	{
+		// While load-aware offloading has moved the Actor's group, its home worker type keeps the EntityACL. The home worker
+		// applies the new owner when it gets the group back, which happens as soon as this worker reports the group as owned.
+		if (!NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
+		{
+			UE_LOG(LogSpatialActorChannel, Verbose, TEXT("Owner of Actor %s changed on a worker without EntityACL authority, leaving it to the worker type owning its actor group. Entity: %lld"),
+				*Actor->GetName(), EntityId);
+			return;
+		}
+
 		bool bSuccess = Sender->UpdateEntityACLs(EntityId, NewOwnerWorkerAttribute);
 
 		if (bSuccess)
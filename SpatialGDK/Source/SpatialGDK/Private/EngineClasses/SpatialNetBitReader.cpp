@@ -27,7 +27,7 @@ void FSpatialNetBitReader::DeserializeObjectRef(FUnrealObjectRef& ObjectRef)
 		FString Path;
 		*this << Path;
 
-		ObjectRef.Path = Path;
+		ObjectRef.Path = FName(*Path);
 	}
 
 	uint8 HasOuter;
@@ -37,6 +37,8 @@ void FSpatialNetBitReader::DeserializeObjectRef(FUnrealObjectRef& ObjectRef)
 		ObjectRef.Outer = FUnrealObjectRef();
 		DeserializeObjectRef(*ObjectRef.Outer);
 	}
+
+	ObjectRef.UpdateChainId();
 }
 
 FArchive& FSpatialNetBitReader::operator<<(UObject*& Value)
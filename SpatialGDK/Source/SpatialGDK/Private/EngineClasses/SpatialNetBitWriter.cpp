@@ -27,7 +27,8 @@ void FSpatialNetBitWriter::SerializeObjectRef(FUnrealObjectRef& ObjectRef)
 	SerializeBits(&HasPath, 1);
 	if (HasPath)
 	{
-		*this << ObjectRef.Path.GetValue();
+		FString Path = ObjectRef.Path->ToString();
+		*this << Path;
 	}
 
 	uint8 HasOuter = ObjectRef.Outer.IsSet();
@@ -2,6 +2,7 @@
 
 #include "EngineClasses/SpatialNetDriver.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/ActorChannel.h"
 #include "Engine/ChildConnection.h"
 #include "Engine/Engine.h"
@@ -34,8 +35,10 @@
 #include "Utils/EntityPool.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/OpUtils.h"
+#include "Utils/SpatialActorUtils.h"
 #include "Utils/SpatialMetrics.h"
 #include "Utils/SpatialMetricsDisplay.h"
+#include "Utils/SpatialStatics.h"
 
 #if WITH_EDITOR
 #include "SpatialGDKServicesModule.h"
@@ -44,6 +47,7 @@
 DEFINE_LOG_CATEGORY(LogSpatialOSNetDriver);
 
 DECLARE_CYCLE_STAT(TEXT("ServerReplicateActors"), STAT_SpatialServerReplicateActors, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("ServerReplicateActorsCompareProperties"), STAT_SpatialServerReplicateActorsCompareProperties, STATGROUP_SpatialNet);
 DEFINE_STAT(STAT_SpatialConsiderList);
 
 USpatialNetDriver::USpatialNetDriver(const FObjectInitializer& ObjectInitializer)
@@ -56,6 +60,10 @@ USpatialNetDriver::USpatialNetDriver(const FObjectInitializer& ObjectInitializer
 	, bMapLoaded(false)
 	, NextRPCIndex(0)
 	, TimeWhenPositionLastUpdated(0.f)
+	, TimeWhenConsiderListLastReconciled(-1.f)
+	, TimeWhenWorkerLoadLastReported(-1.f)
+	, ReplicationBytesSentThisTick(0)
+	, PositionDistanceThresholdSquared(0.f)
 {
 }
 
@@ -71,6 +79,8 @@ bool USpatialNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, c
 
 	bConnectAsClient = bInitAsClient;
 
+	PositionDistanceThresholdSquared = FMath::Square(GetDefault<USpatialGDKSettings>()->PositionDistanceThreshold);
+
 	FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USpatialNetDriver::OnMapLoaded);
 
 	FWorldDelegates::LevelAddedToWorld.AddUObject(this, &USpatialNetDriver::OnLevelAddedToWorld);
@@ -125,7 +135,7 @@ bool USpatialNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, c
 
 	if (!bInitAsClient)
 	{
-		GatherClientInterestDistances();
+		ClassInfoManager->GetClientInterestDistances().Gather(*ClassInfoManager->SchemaDatabase);
 	}
 
 #if WITH_EDITOR
@@ -386,6 +396,16 @@ void USpatialNetDriver::OnMapLoaded(UWorld* LoadedWorld)
 		return;
 	}
 
+	if (GuidCache.IsValid())
+	{
+		static_cast<FSpatialNetGUIDCache*>(GuidCache.Get())->ClearRemappedPaths();
+	}
+
+	if (GetDefault<USpatialGDKSettings>()->bEnableClassInfoWarmUp && ClassInfoManager != nullptr)
+	{
+		ClassInfoManager->StartClassInfoWarmUp();
+	}
+
 	// If we're the client, we can now ask the server to spawn our controller.
 	if (!IsServer())
 	{
@@ -413,6 +433,11 @@ void USpatialNetDriver::OnLevelAddedToWorld(ULevel* LoadedLevel, UWorld* OwningW
 		return;
 	}
 
+	if (GuidCache.IsValid())
+	{
+		static_cast<FSpatialNetGUIDCache*>(GuidCache.Get())->ClearRemappedPaths();
+	}
+
 	// If we have authority over the GSM when loading a sublevel, make sure we have authority
 	// over the actors in the sublevel.
 	if (GlobalStateManager != nullptr)
@@ -425,6 +450,7 @@ void USpatialNetDriver::OnLevelAddedToWorld(ULevel* LoadedLevel, UWorld* OwningW
 				{
 					Actor->Role = ROLE_Authority;
 					Actor->RemoteRole = ROLE_SimulatedProxy;
+					AddActorToConsiderList(Actor);
 				}
 			}
 		}
@@ -466,6 +492,20 @@ void USpatialNetDriver::OnAcceptingPlayersChanged(bool bAcceptingPlayers)
 	}
 }
 
+void USpatialNetDriver::ApplyActorGroupAssignments(const TMap<FString, FString>& OffloadedActorGroupToWorkerType)
+{
+	if (ActorGroupManager == nullptr)
+	{
+		return;
+	}
+
+	for (const FName& ActorGroup : ActorGroupManager->ApplyActorGroupAssignments(OffloadedActorGroupToWorkerType))
+	{
+		ClassInfoManager->UpdateWorkerTypeForActorGroup(ActorGroup);
+		Sender->UpdateActorGroupWorkerType(ActorGroup);
+	}
+}
+
 // NOTE: This method is a clone of the ProcessServerTravel located in GameModeBase with modifications to support Spatial.
 // Will be called via a delegate that has been set in the UWorld instead of the original in GameModeBase.
 void USpatialNetDriver::SpatialProcessServerTravel(const FString& URL, bool bAbsolute, AGameModeBase* GameMode)
@@ -637,12 +677,61 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 	// Remove this actor from the network object list
 	GetNetworkObjectList().Remove(ThisActor);
 
+	ActorGrid.RemoveActor(ThisActor);
+	ReplicationTimingWheel.Unschedule(ThisActor);
+	ActorsDroppedFromConsiderList.Remove(ThisActor);
+
 	// Remove from renamed list if destroyed
 	RenamedStartupActors.Remove(ThisActor->GetFName());
 }
 
+void USpatialNetDriver::ForceNetUpdate(AActor* Actor)
+{
+	Super::ForceNetUpdate(Actor);
+
+	AddActorToConsiderList(Actor);
+}
+
+void USpatialNetDriver::FlushActorDormancy(AActor* Actor, bool bWasDormInitial /*= false*/)
+{
+	Super::FlushActorDormancy(Actor, bWasDormInitial);
+
+	AddActorToConsiderList(Actor);
+}
+
+void USpatialNetDriver::AddActorToConsiderList(AActor* Actor)
+{
+	if (World == nullptr || !IsServer() || !GetDefault<USpatialGDKSettings>()->bUsePersistentConsiderList)
+	{
+		return;
+	}
+
+	// This actor may belong to a different net driver.
+	if (Actor->GetNetDriverName() != NetDriverName)
+	{
+		return;
+	}
+
+	ActorsDroppedFromConsiderList.Remove(Actor);
+	ReplicationTimingWheel.Schedule(Actor, World->TimeSeconds);
+}
+
+void USpatialNetDriver::OnActorSpawned(AActor* Actor)
+{
+	if (Actor->GetIsReplicated())
+	{
+		AddActorToConsiderList(Actor);
+	}
+}
+
 void USpatialNetDriver::Shutdown()
 {
+	if (World != nullptr && OnActorSpawnedDelegateHandle.IsValid())
+	{
+		World->RemoveOnActorSpawnedHandler(OnActorSpawnedDelegateHandle);
+		OnActorSpawnedDelegateHandle.Reset();
+	}
+
 	if (!IsServer())
 	{
 		// Notify the server that we're disconnecting so it can clean up our actors.
@@ -669,6 +758,16 @@ void USpatialNetDriver::OnOwnerUpdated(AActor* Actor)
 		return;
 	}
 
+	// The Actor is now part of the position hierarchies of its owner chain. The hierarchy it was removed from
+	// notices by itself, see USpatialActorChannel::IsPositionHierarchyValid.
+	for (AActor* ChainActor = Actor; ChainActor != nullptr; ChainActor = ChainActor->GetOwner())
+	{
+		if (USpatialActorChannel* ChainChannel = GetActorChannelByEntityId(PackageMap->GetEntityIdFromObject(ChainActor)))
+		{
+			ChainChannel->InvalidatePositionHierarchy();
+		}
+	}
+
 	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
 	if (EntityId == SpatialConstants::INVALID_ENTITY_ID)
 	{
@@ -683,7 +782,7 @@ void USpatialNetDriver::OnOwnerUpdated(AActor* Actor)
 
 	Channel->MarkInterestDirty();
 
-	Channel->ServerProcessOwnershipChange();
+	Sender->QueueOwnershipChange(Channel);
 }
 
 //SpatialGDK: Functions in the ifdef block below are modified versions of the UNetDriver:: implementations.
@@ -698,6 +797,71 @@ static FORCEINLINE_DEBUGGABLE bool IsActorRelevantToConnection(const AActor* Act
 	return true;
 }
 
+// SpatialGDK: Returns true if this actor's relevancy can't be decided by the replication grid, either because it doesn't depend on
+// distance to a viewer or because the actor doesn't have an entity yet. These actors go through the same checks as without the grid.
+static FORCEINLINE_DEBUGGABLE bool IsActorExemptFromReplicationGrid(const AActor* Actor, const UActorChannel* Channel)
+{
+	const USpatialActorChannel* SpatialChannel = Cast<USpatialActorChannel>(Channel);
+
+	return SpatialChannel == nullptr
+		|| SpatialChannel->bCreatingNewEntity
+		|| Actor->bAlwaysRelevant
+		|| Actor->bOnlyRelevantToOwner
+		|| Actor->bNetUseOwnerRelevancy
+		|| Actor->GetNetConnection() != nullptr
+		|| Actor->GetTearOff();
+}
+
+// SpatialGDK: Returns true if this actor is within cull distance of one of the viewers covering its replication grid cell.
+// The viewers it is relevant to are written to OutRelevantViewers so that its priority is only evaluated against those.
+static FORCEINLINE_DEBUGGABLE bool IsActorRelevantToGridViewers(AActor* Actor, USpatialActorChannel* Channel, const TArray<FNetViewer>& ConnectionViewers, FSpatialActorGrid& ActorGrid, const float MaxNetCullDistanceSquared, FSpatialActorGrid::FViewerIndices& OutRelevantViewers)
+{
+	// Actors are added to the grid by their next position update, e.g. after the cell size changed.
+	if (!ActorGrid.IsTracked(Actor))
+	{
+		ActorGrid.UpdateActor(Actor, Channel->GetActorSpatialPosition(Actor));
+	}
+
+	const FSpatialActorGrid::FViewerIndices* CellViewers = ActorGrid.GetViewersForActor(Actor);
+	if (CellViewers == nullptr)
+	{
+		return false;
+	}
+
+	// The location the cell was computed from, so the distance check and the cell always agree.
+	const FVector ActorLocation = *ActorGrid.GetActorLocation(Actor);
+
+	const float CullDistanceSquared = FMath::Min(Actor->NetCullDistanceSquared, MaxNetCullDistanceSquared);
+
+	OutRelevantViewers.Reset();
+	for (const int32 ViewerIndex : *CellViewers)
+	{
+		if (FVector::DistSquared(ConnectionViewers[ViewerIndex].ViewLocation, ActorLocation) <= CullDistanceSquared)
+		{
+			OutRelevantViewers.Add(ViewerIndex);
+		}
+	}
+
+	return OutRelevantViewers.Num() > 0;
+}
+
+// SpatialGDK: Equivalent to the FActorPriority constructor, but only takes into account the viewers the actor is relevant to.
+static FORCEINLINE_DEBUGGABLE FActorPriority CreateGridActorPriority(UNetConnection* InConnection, UActorChannel* Channel, FNetworkObjectInfo* ActorInfo, const TArray<FNetViewer>& ConnectionViewers, const FSpatialActorGrid::FViewerIndices& RelevantViewers, const bool bLowNetBandwidth)
+{
+	FActorPriority ActorPriority;
+	ActorPriority.ActorInfo = ActorInfo;
+	ActorPriority.Channel = Channel;
+
+	const float Time = Channel ? (InConnection->Driver->Time - Channel->LastUpdateTime) : InConnection->Driver->SpawnPrioritySeconds;
+	for (const int32 ViewerIndex : RelevantViewers)
+	{
+		const FNetViewer& Viewer = ConnectionViewers[ViewerIndex];
+		ActorPriority.Priority = FMath::Max<int32>(ActorPriority.Priority, FMath::RoundToInt(65536.0f * ActorInfo->Actor->GetNetPriority(Viewer.ViewLocation, Viewer.ViewDir, Viewer.InViewer, Viewer.ViewTarget, Channel, Time, bLowNetBandwidth)));
+	}
+
+	return ActorPriority;
+}
+
 // Returns true if this actor is considered dormant (and all properties caught up) to the current connection
 static FORCEINLINE_DEBUGGABLE bool IsActorDormant(FNetworkObjectInfo* ActorInfo, UNetConnection* Connection)
 {
@@ -770,6 +934,247 @@ int32 USpatialNetDriver::ServerReplicateActors_PrepConnections(const float Delta
 	return bFoundReadyConnection ? NumClientsToTick : 0;
 }
 
+// SpatialGDK: Equivalent to UNetDriver::ServerReplicateActors_BuildConsiderList, but rather than walking every active network object each tick,
+// only visits the actors whose next net update time has passed according to ReplicationTimingWheel.
+// Actors join the wheel when spawned, when their level is loaded, when gaining authority, when woken from dormancy or through ForceNetUpdate,
+// and leave it when they are destroyed, lose authority or go dormant on all connections.
+void USpatialNetDriver::ServerReplicateActors_BuildSpatialConsiderList(TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime)
+{
+	if (!OnActorSpawnedDelegateHandle.IsValid())
+	{
+		OnActorSpawnedDelegateHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &USpatialNetDriver::OnActorSpawned));
+	}
+
+	// Pick up any actors that became active through a path we don't hook.
+	if (TimeWhenConsiderListLastReconciled < 0.f || World->TimeSeconds - TimeWhenConsiderListLastReconciled >= GetDefault<USpatialGDKSettings>()->ConsiderListReconcileInterval)
+	{
+		ReconcileConsiderList();
+		TimeWhenConsiderListLastReconciled = World->TimeSeconds;
+	}
+
+	TArray<AActor*> DueActors;
+	ReplicationTimingWheel.PopDue(World->TimeSeconds, DueActors);
+
+	const bool bUseAdapativeNetFrequency = IsAdaptiveNetUpdateFrequencyEnabled();
+	TArray<AActor*> ActorsToRemove;
+
+	for (AActor* Actor : DueActors)
+	{
+		TSharedPtr<FNetworkObjectInfo>* ActorInfoPtr = GetNetworkObjectList().Find(Actor);
+		if (ActorInfoPtr == nullptr || !GetNetworkObjectList().GetActiveObjects().Contains(*ActorInfoPtr))
+		{
+			// Either no longer a network actor, or dormant on all connections. It will be added back when flushed.
+			if (ActorInfoPtr != nullptr)
+			{
+				ActorsDroppedFromConsiderList.Add(Actor);
+			}
+			continue;
+		}
+
+		FNetworkObjectInfo* ActorInfo = ActorInfoPtr->Get();
+
+		if (!ActorInfo->bPendingNetUpdate && World->TimeSeconds <= ActorInfo->NextUpdateTime)
+		{
+			// The next update time was pushed back after this actor was scheduled.
+			ReplicationTimingWheel.Schedule(Actor, ActorInfo->NextUpdateTime);
+			continue;
+		}
+
+		if (Actor->IsPendingKillPending() || Actor->GetRemoteRole() == ROLE_None)
+		{
+			ActorsToRemove.Add(Actor);
+			continue;
+		}
+
+		// We only replicate actors we are authoritative over, this actor will be added back when gaining authority.
+		if (!Actor->HasAuthority())
+		{
+			ActorsDroppedFromConsiderList.Add(Actor);
+			continue;
+		}
+
+		// This actor may belong to a different net driver, make sure this is the correct one.
+		// It's not added back, as AddActorToConsiderList and ReconcileConsiderList skip actors of other net drivers.
+		if (Actor->GetNetDriverName() != NetDriverName)
+		{
+			UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Actor %s in wrong network actors list!"), *Actor->GetName());
+			continue;
+		}
+
+		// Verify the actor is actually initialized (it might have been intentionally spawn deferred until a later frame)
+		// and that it isn't still streaming in or out. Check again next tick.
+		ULevel* Level = Actor->GetLevel();
+		if (!Actor->IsActorInitialized() || Level->HasVisibilityChangeRequestPending() || Level->bIsAssociatingLevel)
+		{
+			ReplicationTimingWheel.Schedule(Actor, World->TimeSeconds);
+			continue;
+		}
+
+		if (Actor->NetDormancy == DORM_Initial && Actor->IsNetStartupActor())
+		{
+			ActorsToRemove.Add(Actor);
+			continue;
+		}
+
+		// Set defaults if this actor is replicating for first time
+		if (ActorInfo->LastNetReplicateTime == 0)
+		{
+			ActorInfo->LastNetReplicateTime = World->TimeSeconds;
+			ActorInfo->OptimalNetUpdateDelta = 1.0f / Actor->NetUpdateFrequency;
+		}
+
+		const float ScaleDownStartTime = 2.0f;
+		const float ScaleDownTimeRange = 5.0f;
+
+		const float LastReplicateDelta = World->TimeSeconds - ActorInfo->LastNetReplicateTime;
+
+		if (LastReplicateDelta > ScaleDownStartTime)
+		{
+			if (Actor->MinNetUpdateFrequency == 0.0f)
+			{
+				Actor->MinNetUpdateFrequency = 2.0f;
+			}
+
+			// Calculate min delta (max rate actor will update), and max delta (slowest rate actor will update)
+			const float MinOptimalDelta = 1.0f / Actor->NetUpdateFrequency;
+			const float MaxOptimalDelta = FMath::Max(1.0f / Actor->MinNetUpdateFrequency, MinOptimalDelta);
+
+			// Interpolate between MinOptimalDelta/MaxOptimalDelta based on how long it's been since this actor actually sent anything
+			const float Alpha = FMath::Clamp((LastReplicateDelta - ScaleDownStartTime) / ScaleDownTimeRange, 0.0f, 1.0f);
+			ActorInfo->OptimalNetUpdateDelta = FMath::Lerp(MinOptimalDelta, MaxOptimalDelta, Alpha);
+		}
+
+		if (!ActorInfo->bPendingNetUpdate)
+		{
+			const float NextUpdateDelta = bUseAdapativeNetFrequency ? ActorInfo->OptimalNetUpdateDelta : 1.0f / Actor->NetUpdateFrequency;
+
+			ActorInfo->NextUpdateTime = World->TimeSeconds + FMath::SRand() * ServerTickTime + NextUpdateDelta;
+			ActorInfo->LastNetUpdateTime = Time;
+		}
+
+		ActorInfo->bPendingNetUpdate = false;
+
+		ReplicationTimingWheel.Schedule(Actor, ActorInfo->NextUpdateTime);
+
+		OutConsiderList.Add(ActorInfo);
+
+		// Call PreReplication on all actors that will be considered
+		Actor->CallPreReplication(this);
+	}
+
+	for (AActor* Actor : ActorsToRemove)
+	{
+		RemoveNetworkActor(Actor);
+	}
+}
+
+// SpatialGDK: Schedules any authoritative active network actor that isn't in the persistent consider list.
+// The first pass walks every active network actor, to pick up the actors loaded with the map.
+// Later passes only check the actors dropped from the consider list.
+void USpatialNetDriver::ReconcileConsiderList()
+{
+	auto ShouldSchedule = [this](const AActor* Actor)
+	{
+		return Actor->HasAuthority() && Actor->GetNetDriverName() == NetDriverName && !ReplicationTimingWheel.IsScheduled(Actor);
+	};
+
+	if (TimeWhenConsiderListLastReconciled < 0.f)
+	{
+		for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects())
+		{
+			AActor* Actor = ObjectInfo->Actor;
+			if (Actor != nullptr && ShouldSchedule(Actor))
+			{
+				ReplicationTimingWheel.Schedule(Actor, ObjectInfo->NextUpdateTime);
+			}
+		}
+		return;
+	}
+
+	for (auto It = ActorsDroppedFromConsiderList.CreateIterator(); It; ++It)
+	{
+		AActor* Actor = It->Get();
+		if (Actor == nullptr)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		TSharedPtr<FNetworkObjectInfo>* ActorInfoPtr = GetNetworkObjectList().Find(Actor);
+		if (ActorInfoPtr == nullptr)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (GetNetworkObjectList().GetActiveObjects().Contains(*ActorInfoPtr) && ShouldSchedule(Actor))
+		{
+			ReplicationTimingWheel.Schedule(Actor, (*ActorInfoPtr)->NextUpdateTime);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void USpatialNetDriver::UpdateLoadAwareOffloading()
+{
+	UWorld* World = GetWorld();
+	const UGameInstance* GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+	if (GameInstance == nullptr)
+	{
+		return;
+	}
+
+	// Every server worker reports its load, so the reassignments are decided from the load of all the workers of a type rather than just this one.
+	if (TimeWhenWorkerLoadLastReported < 0.f || World->TimeSeconds - TimeWhenWorkerLoadLastReported >= GetDefault<USpatialGDKSettings>()->MetricsReportRate)
+	{
+		TimeWhenWorkerLoadLastReported = World->TimeSeconds;
+		GlobalStateManager->SendWorkerLoadReport(GameInstance->GetSpatialWorkerType(), SpatialMetrics->GetWorkerLoad(), GetOwnedLoadAwareActorGroups());
+	}
+
+	// Reassignments are shared with every worker through the GSM, so only the worker authoritative over them makes any.
+	if (!GlobalStateManager->HasActorGroupAssignmentsAuthority())
+	{
+		return;
+	}
+
+	const TArray<SpatialGDK::ActorGroupReassignment> Reassignments = ActorGroupManager->UpdateLoadAwareOffloading(FPlatformTime::Seconds());
+	if (Reassignments.Num() == 0)
+	{
+		return;
+	}
+
+	StringToStringMap OffloadedActorGroupToWorkerType = GlobalStateManager->OffloadedActorGroupToWorkerType;
+	ActorGroupManager->AddReassignmentsToOffloadedActorGroups(Reassignments, OffloadedActorGroupToWorkerType);
+	GlobalStateManager->SetOffloadedActorGroups(OffloadedActorGroupToWorkerType);
+}
+
+TArray<FString> USpatialNetDriver::GetOwnedLoadAwareActorGroups()
+{
+	// Only the home worker type can update the EntityACL when one of these Actors changes owner, so their groups are kept home.
+	TSet<FName> OwnedActorGroups;
+	for (const auto& EntityChannelPair : GetEntityToActorChannelMap())
+	{
+		AActor* Actor = EntityChannelPair.Value != nullptr ? EntityChannelPair.Value->Actor : nullptr;
+		if (Actor == nullptr || !Actor->HasAuthority() || SpatialGDK::GetOwnerWorkerAttribute(Actor).IsEmpty())
+		{
+			continue;
+		}
+
+		const FName ActorGroup = ActorGroupManager->GetActorGroupForClass(Actor->GetClass());
+		if (ActorGroupManager->IsLoadAwareActorGroup(ActorGroup))
+		{
+			OwnedActorGroups.Add(ActorGroup);
+		}
+	}
+
+	TArray<FString> OwnedActorGroupNames;
+	for (const FName& ActorGroup : OwnedActorGroups)
+	{
+		OwnedActorGroupNames.Add(ActorGroup.ToString());
+	}
+	return OwnedActorGroupNames;
+}
+
 int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection* InConnection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors)
 {
 	// Get list of visible/relevant actors.
@@ -795,6 +1200,17 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 		AGameNetworkManager* const NetworkManager = World->NetworkManager;
 		const bool bLowNetBandwidth = NetworkManager ? NetworkManager->IsInLowBandwidthMode() : false;
 
+		// SpatialGDK: The replication grid can only cull when there are viewers to test against and the cull distance is bounded.
+		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+		const bool bUseReplicationGrid = SpatialGDKSettings->bUseReplicationGrid && ConnectionViewers.Num() > 0 && SpatialGDKSettings->MaxNetCullDistanceSquared > 0.0f;
+		if (bUseReplicationGrid)
+		{
+			ActorGrid.SetCellSize(SpatialGDKSettings->ReplicationGridCellSize);
+			ActorGrid.UpdateViewers(ConnectionViewers, FMath::Sqrt(SpatialGDKSettings->MaxNetCullDistanceSquared));
+		}
+
+		FSpatialActorGrid::FViewerIndices RelevantGridViewers;
+
 		for (FNetworkObjectInfo* ActorInfo : ConsiderList)
 		{
 			AActor* Actor = ActorInfo->Actor;
@@ -820,8 +1236,20 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 
 			// SpatialGDK: Here, Unreal does initial relevancy checking and level load checking.
 			// We have removed the level load check because it doesn't apply.
-			// Relevancy checking is also mostly just a pass through, might be removed later.
-			if (!IsActorRelevantToConnection(Actor, ConnectionViewers))
+			// Relevancy checking is also mostly just a pass through, unless the replication grid is enabled.
+			const bool bUseGridForActor = bUseReplicationGrid && !IsActorExemptFromReplicationGrid(Actor, Channel);
+			if (bUseGridForActor)
+			{
+				USpatialActorChannel* SpatialChannel = Cast<USpatialActorChannel>(Channel);
+				if (!IsActorRelevantToGridViewers(Actor, SpatialChannel, ConnectionViewers, ActorGrid, SpatialGDKSettings->MaxNetCullDistanceSquared, RelevantGridViewers))
+				{
+					// Culled Actors aren't replicated, but still send their SpatialOS position as they would if they were.
+					// That keeps their grid cell up to date, and their position in the runtime for interest and other workers.
+					SpatialChannel->QueueSpatialPositionUpdate();
+					continue;
+				}
+			}
+			else if (!IsActorRelevantToConnection(Actor, ConnectionViewers))
 			{
 				// If not relevant (and we don't have a channel), skip
 				continue;
@@ -835,7 +1263,14 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 
 				Actor->NetTag = NetTag;
 
-				OutPriorityList[FinalSortedCount] = FActorPriority(PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth);
+				if (bUseGridForActor)
+				{
+					OutPriorityList[FinalSortedCount] = CreateGridActorPriority(PriorityConnection, Channel, ActorInfo, ConnectionViewers, RelevantGridViewers, bLowNetBandwidth);
+				}
+				else
+				{
+					OutPriorityList[FinalSortedCount] = FActorPriority(PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth);
+				}
 				OutPriorityActors[FinalSortedCount] = OutPriorityList + FinalSortedCount;
 
 				FinalSortedCount++;
@@ -866,6 +1301,44 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 	return FinalSortedCount;
 }
 
+int32 USpatialNetDriver::ServerReplicateActors_CompareProperties(FActorPriority** PriorityActors, const int32 StartIndex, const int32 FinalSortedCount, const int32 MaxActorsToCompare)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialServerReplicateActorsCompareProperties);
+
+	const int32 BatchSize = FMath::Min(FMath::Max(static_cast<int32>(GetDefault<USpatialGDKSettings>()->ParallelPropertyComparisonMinActors), 1), MaxActorsToCompare);
+
+	// Only existing channels are compared, new entities are created with all of their properties regardless.
+	// Class infos are looked up here on the game thread, as looking one up may create it.
+	TArray<TPair<USpatialActorChannel*, const FClassInfo*>> Channels;
+	int32 j = StartIndex;
+	for (; j < FinalSortedCount && Channels.Num() < BatchSize; j++)
+	{
+		if (PriorityActors[j]->ActorInfo == nullptr)
+		{
+			continue;
+		}
+
+		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(PriorityActors[j]->Channel);
+		if (Channel != nullptr && Channel->Actor != nullptr && !Channel->Actor->GetTearOff() && Channel->CanCompareProperties())
+		{
+			Channels.Emplace(Channel, &ClassInfoManager->GetOrCreateClassInfoByClass(Channel->Actor->GetClass()));
+		}
+	}
+
+	// A smaller batch is left to the replication loop.
+	if (Channels.Num() < BatchSize || BatchSize < 2)
+	{
+		return j;
+	}
+
+	ParallelFor(Channels.Num(), [&Channels](int32 Index)
+	{
+		Channels[Index].Key->CompareProperties(*Channels[Index].Value);
+	});
+
+	return j;
+}
+
 void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* InConnection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated)
 {
 	// SpatialGDK - Here Unreal would check if the InConnection was saturated (!IsNetReady) and early out. Removed this as we do not currently use channel saturation.
@@ -883,6 +1356,57 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 	int32 MaxActorsToReplicate = (ActorReplicationRateLimit > 0) ? ActorReplicationRateLimit : INT32_MAX;
 	int32 FinalReplicatedCount = 0;
 
+	// SpatialGDK - Actor replication byte limits based on config values, per worker and per client connection.
+	// All Actors replicate through the single spatial connection, so the per connection limit applies to the client connection owning each Actor.
+	uint32 ActorReplicationByteLimit = GetDefault<USpatialGDKSettings>()->ActorReplicationByteLimit;
+	int64 MaxBytesToReplicate = (ActorReplicationByteLimit > 0) ? ActorReplicationByteLimit : INT64_MAX;
+	uint32 ActorReplicationByteLimitPerConnection = GetDefault<USpatialGDKSettings>()->ActorReplicationByteLimitPerConnection;
+	int64 MaxBytesToReplicatePerConnection = (ActorReplicationByteLimitPerConnection > 0) ? ActorReplicationByteLimitPerConnection : INT64_MAX;
+	TMap<UNetConnection*, int64>& BytesSentPerOwningConnection = ReplicationBytesSentPerOwningConnection;
+	BytesSentPerOwningConnection.Reset();
+	int32 NumActorsDeferredByByteLimit = 0;
+
+	// SpatialGDK - Actor replication time budgeting, adjusted each tick by ReplicationBudget.
+	// Actors that haven't replicated for ReplicationStarvationTime are replicated regardless, so low priority actors aren't starved.
+	const bool bUseReplicationBudget = GetDefault<USpatialGDKSettings>()->bEnableAdaptiveReplicationBudget;
+	const float ReplicationStarvationTime = GetDefault<USpatialGDKSettings>()->ReplicationStarvationTime;
+	const double ReplicationLoopStartTime = FPlatformTime::Seconds();
+	const double ReplicationDeadline = ReplicationLoopStartTime + ReplicationBudget.GetBudget();
+	int32 NumActorsDeferredByBudget = 0;
+
+	auto HasReplicationBudget = [&](const AActor* Actor, const UActorChannel* ActorChannel)
+	{
+		const bool bWithinTimeBudget = !bUseReplicationBudget || FPlatformTime::Seconds() < ReplicationDeadline;
+
+		bool bWithinByteLimits = ReplicationBytesSentThisTick < MaxBytesToReplicate;
+		if (bWithinByteLimits && ActorReplicationByteLimitPerConnection > 0)
+		{
+			const int64* BytesSentOwningConnection = BytesSentPerOwningConnection.Find(Actor->GetNetConnection());
+			bWithinByteLimits = BytesSentOwningConnection == nullptr || *BytesSentOwningConnection < MaxBytesToReplicatePerConnection;
+		}
+
+		// The byte limits cap egress, so they apply to starved actors too.
+		if (!bWithinByteLimits)
+		{
+			NumActorsDeferredByByteLimit++;
+			return false;
+		}
+
+		if (bWithinTimeBudget || (ActorChannel != nullptr && Time - ActorChannel->LastUpdateTime > ReplicationStarvationTime))
+		{
+			return true;
+		}
+
+		// Only deferrals caused by the time budget feed back into it.
+		NumActorsDeferredByBudget++;
+		return false;
+	};
+
+	// SpatialGDK - Properties are compared in parallel a batch at a time, starting from the first Actor of the batch that is about to replicate.
+	// ReplicateActor then reuses the resulting changelists. Actors compared but then deferred keep their changes in the changelist history.
+	const bool bParallelPropertyComparison = GetDefault<USpatialGDKSettings>()->bParallelPropertyComparison;
+	int32 NextActorToCompare = 0;
+
 	for (int32 j = 0; j < FinalSortedCount; j++)
 	{
 		// Deletion entry
@@ -946,12 +1470,17 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 				bIsRelevant = true;
 				FinalCreationCount++;
 			}
-			// SpatialGDK - We will only replicate the highest priority actors up the the rate limit and the final tick of TearOff actors.
+			// SpatialGDK - We will only replicate the highest priority actors up the the rate limit (and replication budget) and the final tick of TearOff actors.
 			// Actors not replicated this frame will have their priority increased based on the time since the last replicated.
 			// TearOff actors would normally replicate their final tick due to RecentlyRelevant, after which the channel is closed.
 			// With throttling we no longer always replicate when RecentlyRelevant is true, thus we ensure to always replicate a TearOff actor while it still has a channel.
-			else if ((FinalReplicatedCount < MaxActorsToReplicate && !Actor->GetTearOff()) || (Actor->GetTearOff() && Channel != nullptr))
+			else if ((FinalReplicatedCount < MaxActorsToReplicate && !Actor->GetTearOff() && HasReplicationBudget(Actor, Channel)) || (Actor->GetTearOff() && Channel != nullptr))
 			{
+				if (bParallelPropertyComparison && j >= NextActorToCompare)
+				{
+					NextActorToCompare = ServerReplicateActors_CompareProperties(PriorityActors, j, FinalSortedCount, MaxActorsToReplicate - FinalReplicatedCount);
+				}
+
 				bIsRelevant = true;
 				FinalReplicatedCount++;
 			}
@@ -1004,7 +1533,18 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 							LastRelevantActors.Add(Actor);
 						}
 
-						if (Channel->ReplicateActor())
+						const int64 BitsWritten = Channel->ReplicateActor();
+						const int64 BytesWritten = (BitsWritten + 7) / 8;
+						ReplicationBytesSentThisTick += BytesWritten;
+						if (ActorReplicationByteLimitPerConnection > 0 && BytesWritten > 0)
+						{
+							if (UNetConnection* OwningConnection = Actor->GetNetConnection())
+							{
+								BytesSentPerOwningConnection.FindOrAdd(OwningConnection) += BytesWritten;
+							}
+						}
+
+						if (BitsWritten > 0)
 						{
 							ActorUpdatesThisConnectionSent++;
 							if (DebugRelevantActors)
@@ -1050,8 +1590,15 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 		}
 	}
 
+	ReplicationBudget.RecordReplicationLoop(FPlatformTime::Seconds() - ReplicationLoopStartTime, NumActorsDeferredByBudget);
+
+	if (NumActorsDeferredByByteLimit > 0)
+	{
+		UE_LOG(LogSpatialOSNetDriver, Verbose, TEXT("%d Actors deferred to a later tick by the replication byte limits"), NumActorsDeferredByByteLimit);
+	}
+
 	// SpatialGDK - Here Unreal would return the position of the last replicated actor in PriorityActors before the channel became saturated.
-	// In Spatial we use ActorReplicationRateLimit and EntityCreationRateLimit to limit replication so this return value is not relevant.
+	// In Spatial we use ActorReplicationRateLimit, EntityCreationRateLimit and the replication budget to limit replication so this return value is not relevant.
 }
 
 void USpatialNetDriver::ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters)
@@ -1106,6 +1653,16 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 	check(World);
 
+	const double ServerReplicateActorsStartTime = FPlatformTime::Seconds();
+	ReplicationBytesSentThisTick = 0;
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialGDKSettings->bEnableAdaptiveReplicationBudget)
+	{
+		const float* WorkerTypeTargetTimeMs = SpatialGDKSettings->WorkerTypeTargetReplicationTimeMs.Find(USpatialStatics::GetCurrentWorkerType(this));
+		ReplicationBudget.SetTargetTime((WorkerTypeTargetTimeMs != nullptr ? *WorkerTypeTargetTimeMs : SpatialGDKSettings->TargetReplicationTimeMs) / 1000.0);
+	}
+
 	int32 Updated = 0;
 
 	// Bump the ReplicationFrame value to invalidate any properties marked as "unchanged" for this frame.
@@ -1140,7 +1697,14 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 	ConsiderList.Reserve(GetNetworkObjectList().GetActiveObjects().Num());
 
 	// Build the consider list (actors that are ready to replicate)
-	ServerReplicateActors_BuildConsiderList(ConsiderList, ServerTickTime);
+	if (GetDefault<USpatialGDKSettings>()->bUsePersistentConsiderList)
+	{
+		ServerReplicateActors_BuildSpatialConsiderList(ConsiderList, ServerTickTime);
+	}
+	else
+	{
+		ServerReplicateActors_BuildConsiderList(ConsiderList, ServerTickTime);
+	}
 
 	SET_DWORD_STAT(STAT_SpatialConsiderList, ConsiderList.Num());
 
@@ -1205,6 +1769,11 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 	ConsiderListSize = FinalSortedCount;
 #endif
 
+	if (SpatialGDKSettings->bEnableAdaptiveReplicationBudget)
+	{
+		ReplicationBudget.Update(FPlatformTime::Seconds() - ServerReplicateActorsStartTime, Connection->GetNumQueuedOutgoingMessages(), SpatialGDKSettings->MaxQueuedOutgoingMessages);
+	}
+
 	return Updated;
 #else
 	return 0;
@@ -1237,8 +1806,18 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 		if (SpatialMetrics != nullptr && GetDefault<USpatialGDKSettings>()->bEnableMetrics)
 		{
 			SpatialMetrics->TickMetrics();
+
+			if (IsServer() && ActorGroupManager != nullptr && ActorGroupManager->IsLoadAwareOffloadingEnabled())
+			{
+				UpdateLoadAwareOffloading();
+			}
 		}
 	}
+
+	if (ClassInfoManager != nullptr && ClassInfoManager->IsClassInfoWarmUpInProgress())
+	{
+		ClassInfoManager->TickClassInfoWarmUp(GetDefault<USpatialGDKSettings>()->ClassInfoWarmUpBudgetMs);
+	}
 }
 
 void USpatialNetDriver::ProcessRemoteFunction(
@@ -1330,11 +1909,13 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 	double ServerReplicateActorsTimeMs = 0.0f;
 #endif // USE_SERVER_PERF_COUNTERS
 
+	// Refreshed every tick so changes to the setting apply while running.
+	PositionDistanceThresholdSquared = FMath::Square(GetDefault<USpatialGDKSettings>()->PositionDistanceThreshold);
+
 	if (IsServer() && ClientConnections.Num() > 0 && EntityPool->IsReady())
 	{
 		// Update all clients.
 #if WITH_SERVER_CODE
-
 #if USE_SERVER_PERF_COUNTERS
 		double ServerReplicateActorsTimeStart = FPlatformTime::Seconds();
 #endif // USE_SERVER_PERF_COUNTERS
@@ -1368,6 +1949,11 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 #endif // WITH_SERVER_CODE
 	}
 
+	if (Sender != nullptr)
+	{
+		Sender->ProcessOwnershipChanges();
+	}
+
 	if (GetDefault<USpatialGDKSettings>()->bPackRPCs && Sender != nullptr)
 	{
 		Sender->FlushPackedRPCs();
@@ -1643,6 +2229,18 @@ void USpatialPendingNetGame::SendJoin()
 	bSentJoinRequest = true;
 }
 
+FHandoverShadowData USpatialNetDriver::AllocateHandoverShadowData(const FClassInfo& Info)
+{
+	TSharedRef<FHandoverShadowArena>* Arena = HandoverShadowArenas.Find(Info.Class);
+	if (Arena == nullptr)
+	{
+		Arena = &HandoverShadowArenas.Add(Info.Class, MakeShared<FHandoverShadowArena>(Info));
+	}
+
+	const int32 Slot = (*Arena)->Allocate();
+	return { *Arena, Slot, (*Arena)->GetData(Slot) };
+}
+
 void USpatialNetDriver::AddActorChannel(Worker_EntityId EntityId, USpatialActorChannel* Channel)
 {
 	EntityToActorChannel.Add(EntityId, Channel);
@@ -1686,6 +2284,17 @@ USpatialActorChannel* USpatialNetDriver::GetActorChannelByEntityId(Worker_Entity
 	return EntityToActorChannel.FindRef(EntityId);
 }
 
+bool USpatialNetDriver::IsActorReplicatedDataStale(const AActor* Actor) const
+{
+	if (Actor == nullptr || PackageMap == nullptr)
+	{
+		return false;
+	}
+
+	const USpatialActorChannel* Channel = GetActorChannelByEntityId(PackageMap->GetEntityIdFromObject(Actor));
+	return Channel != nullptr && Channel->HasStaleComponents();
+}
+
 USpatialActorChannel* USpatialNetDriver::CreateSpatialActorChannel(AActor* Actor, USpatialNetConnection* InConnection)
 {
 	if (InConnection == nullptr)
@@ -24,38 +24,6 @@ void USpatialPackageMapClient::Init(USpatialNetDriver* InNetDriver)
 	NetDriver = InNetDriver;
 }
 
-void GetSubobjects(UObject* Object, TArray<UObject*>& InSubobjects)
-{
-	InSubobjects.Empty();
-	ForEachObjectWithOuter(Object, [&InSubobjects](UObject* Object)
-	{
-		// Objects can only be allocated NetGUIDs if this is true.
-		if (Object->IsSupportedForNetworking() && !Object->IsPendingKill() && !Object->IsEditorOnly())
-		{
-			// Walk up the outer chain and ensure that no object is PendingKill. This is required because although
-			// EInternalObjectFlags::PendingKill prevents objects that are PendingKill themselves from getting added
-			// to the list, it'll still add children of PendingKill objects. This then causes an assertion within 
-			// FNetGUIDCache::RegisterNetGUID_Server where it again iterates up the object's owner chain, assigning
-			// ids and ensuring that no object is set to PendingKill in the process.
-			UObject* Outer = Object->GetOuter();
-			while (Outer != nullptr)
-			{
-				if (Outer->IsPendingKill())
-				{
-					return;
-				}
-				Outer = Outer->GetOuter();
-			}
-			InSubobjects.Add(Object);
-		}
-	}, true, RF_NoFlags, EInternalObjectFlags::PendingKill);
-
-	InSubobjects.StableSort([](UObject& A, UObject& B)
-	{
-		return A.GetName() < B.GetName();
-	});
-}
-
 Worker_EntityId USpatialPackageMapClient::AllocateEntityIdAndResolveActor(AActor* Actor)
 {
 	check(Actor);
@@ -236,8 +204,8 @@ Worker_EntityId USpatialPackageMapClient::GetEntityIdFromObject(const UObject* O
 		return SpatialConstants::INVALID_ENTITY_ID;
 	}
 
-	FNetworkGUID NetGUID = GetNetGUIDFromObject(Object);
-	return GetUnrealObjectRefFromNetGUID(NetGUID).Entity;
+	FSpatialNetGUIDCache* SpatialGuidCache = static_cast<FSpatialNetGUIDCache*>(GuidCache.Get());
+	return SpatialGuidCache->GetEntityIdFromObject(Object);
 }
 
 bool USpatialPackageMapClient::CanClientLoadObject(UObject* Object)
@@ -279,7 +247,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 		NetGUID = AssignNewStablyNamedObjectNetGUID(Actor);
 
 		// We register the entity id ref here.
-		UnrealObjectRefToNetGUID.Emplace(EntityObjectRef, NetGUID);
+		AddObjectRefToNetGUID(EntityObjectRef, NetGUID);
 
 		// Once we have an entity id, we should always be using it to refer to entities.
 		// Since the path ref may have been registered previously, we first try to remove it
@@ -293,6 +261,8 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 		RegisterObjectRef(NetGUID, EntityObjectRef);
 	}
 
+	ObjectToEntityId.Add(Actor, EntityId);
+
 	UE_LOG(LogSpatialPackageMap, Verbose, TEXT("Registered new object ref for actor: %s. NetGUID: %s, entity ID: %lld"),
 		*Actor->GetName(), *NetGUID.ToString(), EntityId);
 
@@ -319,17 +289,17 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 
 		if (Subobject->IsNameStableForNetworking())
 		{
-			if (Subobject->GetFName().ToString().Equals(TEXT("PersistentLevel")) && !Subobject->IsA<ULevel>())
+			if (Subobject->GetFName() == NAME_PersistentLevel && !Subobject->IsA<ULevel>())
 			{
 				UE_LOG(LogSpatialPackageMap, Fatal, TEXT("Found object called PersistentLevel which isn't a Level! This is not allowed when using the GDK"));
 			}
 
 			// Using StablyNamedRef for the outer since referencing ObjectRef in the map
 			// will have the EntityId
-			FUnrealObjectRef StablyNamedSubobjectRef(0, 0, Subobject->GetFName().ToString(), StablyNamedRef);
+			FUnrealObjectRef StablyNamedSubobjectRef(0, 0, Subobject->GetFName(), StablyNamedRef);
 
 			// This is the only extra object ref that has to be registered for the subobject.
-			UnrealObjectRefToNetGUID.Emplace(StablyNamedSubobjectRef, SubobjectNetGUID);
+			AddObjectRefToNetGUID(StablyNamedSubobjectRef, SubobjectNetGUID);
 
 			// As the subobject may have be referred to previously in replication flow, it would
 			// have it's stable name registered as it's UnrealObjectRef inside NetGUIDToUnrealObjectRef.
@@ -338,6 +308,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 		}
 
 		RegisterObjectRef(SubobjectNetGUID, EntityIdSubobjectRef);
+		ObjectToEntityId.Add(Subobject, EntityId);
 
 		UE_LOG(LogSpatialPackageMap, Verbose, TEXT("Registered new object ref for subobject %s inside actor %s. NetGUID: %s, object ref: %s"),
 			*Subobject->GetName(), *Actor->GetName(), *SubobjectNetGUID.ToString(), *EntityIdSubobjectRef.ToString());
@@ -358,6 +329,7 @@ void FSpatialNetGUIDCache::AssignNewSubobjectNetGUID(UObject* Subobject, const F
 {
 	FNetworkGUID SubobjectNetGUID = GetOrAssignNetGUID_SpatialGDK(Subobject);
 	RegisterObjectRef(SubobjectNetGUID, SubobjectRef);
+	ObjectToEntityId.Add(Subobject, SubobjectRef.Entity);
 
 	Cast<USpatialNetDriver>(Driver)->Receiver->ResolvePendingOperations(Subobject, SubobjectRef);
 }
@@ -383,7 +355,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewStablyNamedObjectNetGUID(UObject* Ob
 	}
 
 
-	if (Object->GetFName().ToString().Equals(TEXT("PersistentLevel")) && !Object->IsA<ULevel>())
+	if (Object->GetFName() == NAME_PersistentLevel && !Object->IsA<ULevel>())
 	{
 		UE_LOG(LogSpatialPackageMap, Fatal, TEXT("Found object called PersistentLevel which isn't a Level! This is not allowed when using the GDK"));
 	}
@@ -396,7 +368,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewStablyNamedObjectNetGUID(UObject* Ob
 		// resolve the references.
 		bNoLoadOnClient = !CanClientLoadObject(Object, NetGUID);
 	}
-	FUnrealObjectRef StablyNamedObjRef(0, 0, Object->GetFName().ToString(), (OuterGUID.IsValid() && !OuterGUID.IsDefault()) ? GetUnrealObjectRefFromNetGUID(OuterGUID) : FUnrealObjectRef(), bNoLoadOnClient);
+	FUnrealObjectRef StablyNamedObjRef(0, 0, Object->GetFName(), (OuterGUID.IsValid() && !OuterGUID.IsDefault()) ? GetUnrealObjectRefFromNetGUID(OuterGUID) : FUnrealObjectRef(), bNoLoadOnClient);
 	RegisterObjectRef(NetGUID, StablyNamedObjRef);
 
 	return NetGUID;
@@ -435,14 +407,14 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 		for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 		{
 			FUnrealObjectRef SubobjectRef(EntityId, SubobjectInfoPair.Key);
-			if (FNetworkGUID* SubobjectNetGUID = UnrealObjectRefToNetGUID.Find(SubobjectRef))
+			if (const FNetworkGUID* SubobjectNetGUID = FindNetGUID(SubobjectRef))
 			{
-				NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
-				UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+				RemoveNetGUIDToObjectRef(*SubobjectNetGUID);
+				RemoveObjectRefToNetGUID(SubobjectRef);
 
 				if (StablyNamedRefOption.IsSet())
 				{
-					UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
+					RemoveObjectRefToNetGUID(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName, StablyNamedRefOption.GetValue()));
 				}
 			}
 		}
@@ -457,8 +429,8 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 			{
 				if (FUnrealObjectRef* SubobjectRef = NetGUIDToUnrealObjectRef.Find(*SubobjectNetGUID))
 				{
-					UnrealObjectRefToNetGUID.Remove(*SubobjectRef);
-					NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
+					RemoveObjectRefToNetGUID(*SubobjectRef);
+					RemoveNetGUIDToObjectRef(*SubobjectNetGUID);
 				}
 			}
 		}
@@ -469,18 +441,18 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 	// TODO: Figure out why NetGUIDToUnrealObjectRef might not have this GUID. UNR-989
 	if (FUnrealObjectRef* ActorRef = NetGUIDToUnrealObjectRef.Find(EntityNetGUID))
 	{
-		UnrealObjectRefToNetGUID.Remove(*ActorRef);
+		RemoveObjectRefToNetGUID(*ActorRef);
 	}
-	NetGUIDToUnrealObjectRef.Remove(EntityNetGUID);
+	RemoveNetGUIDToObjectRef(EntityNetGUID);
 	if (StablyNamedRefOption.IsSet())
 	{
-		UnrealObjectRefToNetGUID.Remove(StablyNamedRefOption.GetValue());
+		RemoveObjectRefToNetGUID(StablyNamedRefOption.GetValue());
 	}
 }
 
 void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& SubobjectRef)
 {
-	if (!UnrealObjectRefToNetGUID.Contains(SubobjectRef))
+	if (FindNetGUID(SubobjectRef) == nullptr)
 	{
 		return;
 	}
@@ -516,13 +488,13 @@ void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& Subobj
 
 			if (StablyNamedRefOption.IsSet())
 			{
-				UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
+				RemoveObjectRefToNetGUID(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName, StablyNamedRefOption.GetValue()));
 			}
 		}
 	}
-	FNetworkGUID SubobjectNetGUID = UnrealObjectRefToNetGUID[SubobjectRef];
-	NetGUIDToUnrealObjectRef.Remove(SubobjectNetGUID);
-	UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+	FNetworkGUID SubobjectNetGUID = *FindNetGUID(SubobjectRef);
+	RemoveNetGUIDToObjectRef(SubobjectNetGUID);
+	RemoveObjectRefToNetGUID(SubobjectRef);
 }
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
@@ -532,7 +504,7 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealOb
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID* CachedGUID = UnrealObjectRefToNetGUID.Find(ObjectRef);
+	const FNetworkGUID* CachedGUID = FindNetGUID(ObjectRef);
 	FNetworkGUID NetGUID = CachedGUID ? *CachedGUID : FNetworkGUID{};
 	if (!NetGUID.IsValid() && ObjectRef.Path.IsSet())
 	{
@@ -559,14 +531,14 @@ void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRe
 		return;
 	}
 
+	TArray<FUnrealObjectRef*, TInlineAllocator<8>> Chain;
 	FUnrealObjectRef* Iterator = &ObjectRef;
 	while (true)
 	{
+		Chain.Add(Iterator);
 		if (Iterator->Path.IsSet())
 		{
-			FString TempPath(*Iterator->Path);
-			GEngine->NetworkRemapPath(Driver, TempPath, bReading);
-			Iterator->Path = TempPath;
+			Iterator->Path = NetworkRemapPath(Iterator->Path.GetValue(), bReading);
 		}
 		if (!Iterator->Outer.IsSet())
 		{
@@ -574,14 +546,42 @@ void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRe
 		}
 		Iterator = &Iterator->Outer.GetValue();
 	}
+
+	// Each ref's chain ID depends on its Outer's, so they're updated from the outermost in.
+	for (int32 Index = Chain.Num() - 1; Index >= 0; Index--)
+	{
+		Chain[Index]->UpdateChainId();
+	}
+}
+
+FName FSpatialNetGUIDCache::NetworkRemapPath(FName Path, bool bReading) const
+{
+	const TPair<FName, bool> Key(Path, bReading);
+	if (const FName* RemappedPath = RemappedPaths.Find(Key))
+	{
+		return *RemappedPath;
+	}
+
+	FString TempPath = Path.ToString();
+	GEngine->NetworkRemapPath(Driver, TempPath, bReading);
+
+	const FName RemappedPath(*TempPath);
+	RemappedPaths.Add(Key, RemappedPath);
+	return RemappedPath;
+}
+
+void FSpatialNetGUIDCache::ClearRemappedPaths()
+{
+	RemappedPaths.Empty();
 }
 
 void FSpatialNetGUIDCache::UnregisterActorObjectRefOnly(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID& NetGUID = UnrealObjectRefToNetGUID.FindChecked(ObjectRef);
+	const FNetworkGUID* NetGUID = FindNetGUID(ObjectRef);
+	check(NetGUID != nullptr);
 	// Remove ObjectRef first so the reference above isn't destroyed
-	NetGUIDToUnrealObjectRef.Remove(NetGUID);
-	UnrealObjectRefToNetGUID.Remove(ObjectRef);
+	RemoveNetGUIDToObjectRef(*NetGUID);
+	RemoveObjectRefToNetGUID(ObjectRef);
 }
 
 FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetworkGUID& NetGUID) const
@@ -592,20 +592,29 @@ FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetw
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromEntityId(Worker_EntityId EntityId) const
 {
-	FUnrealObjectRef ObjRef(EntityId, 0);
-	const FNetworkGUID* NetGUID = UnrealObjectRefToNetGUID.Find(ObjRef);
+	const FNetworkGUID* NetGUID = EntityOffsetToNetGUID.Find(FEntityOffset(EntityId, 0));
 	return (NetGUID == nullptr) ? FNetworkGUID(0) : *NetGUID;
 }
 
-FNetworkGUID FSpatialNetGUIDCache::RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient)
+Worker_EntityId FSpatialNetGUIDCache::GetEntityIdFromObject(const UObject* Object) const
 {
-	// Put the PIE prefix back (if applicable) so that the correct object can be found.
-	FString TempPath = PathName;
-	GEngine->NetworkRemapPath(Driver, TempPath, true);
+	if (const Worker_EntityId_Key* EntityId = ObjectToEntityId.Find(Object))
+	{
+		return *EntityId;
+	}
 
+	// Not an entity actor or subobject, but it may still be registered with a path ref.
+	const FNetworkGUID* NetGUID = NetGUIDLookup.Find(MakeWeakObjectPtr(const_cast<UObject*>(Object)));
+	const FUnrealObjectRef* ObjectRef = NetGUID != nullptr ? NetGUIDToUnrealObjectRef.Find(*NetGUID) : nullptr;
+	return ObjectRef != nullptr ? ObjectRef->Entity : FUnrealObjectRef::UNRESOLVED_OBJECT_REF.Entity;
+}
+
+FNetworkGUID FSpatialNetGUIDCache::RegisterNetGUIDFromPathForStaticObject(FName PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient)
+{
 	// This function should only be called for stably named object references, not dynamic ones.
 	FNetGuidCacheObject CacheObject;
-	CacheObject.PathName = FName(*TempPath);
+	// Put the PIE prefix back (if applicable) so that the correct object can be found.
+	CacheObject.PathName = NetworkRemapPath(PathName, true /*bReading*/);
 	CacheObject.OuterGUID = OuterGUID;
 	CacheObject.bNoLoad = bNoLoadOnClient;		// server decides whether the client should load objects (e.g. don't load levels)
 	CacheObject.bIgnoreWhenMissing = bNoLoadOnClient;
@@ -662,9 +671,53 @@ void FSpatialNetGUIDCache::RegisterObjectRef(FNetworkGUID NetGUID, const FUnreal
 	checkfSlow(!NetGUIDToUnrealObjectRef.Contains(NetGUID) || (NetGUIDToUnrealObjectRef.Contains(NetGUID) && NetGUIDToUnrealObjectRef.FindChecked(NetGUID) == RemappedObjectRef),
 		TEXT("NetGUID to UnrealObjectRef mismatch - NetGUID: %s ObjRef in map: %s ObjRef expected: %s"), *NetGUID.ToString(),
 		*NetGUIDToUnrealObjectRef.FindChecked(NetGUID).ToString(), *RemappedObjectRef.ToString());
-	checkfSlow(!UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) || (UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) && UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef) == NetGUID),
+	checkfSlow(FindNetGUID(RemappedObjectRef) == nullptr || *FindNetGUID(RemappedObjectRef) == NetGUID,
 		TEXT("UnrealObjectRef to NetGUID mismatch - UnrealObjectRef: %s NetGUID in map: %s NetGUID expected: %s"), *NetGUID.ToString(),
-		*UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef).ToString(), *RemappedObjectRef.ToString());
+		*FindNetGUID(RemappedObjectRef)->ToString(), *RemappedObjectRef.ToString());
 	NetGUIDToUnrealObjectRef.Emplace(NetGUID, RemappedObjectRef);
-	UnrealObjectRefToNetGUID.Emplace(RemappedObjectRef, NetGUID);
+	AddObjectRefToNetGUID(RemappedObjectRef, NetGUID);
+}
+
+const FNetworkGUID* FSpatialNetGUIDCache::FindNetGUID(const FUnrealObjectRef& ObjectRef) const
+{
+	if (IsEntityObjectRef(ObjectRef))
+	{
+		return EntityOffsetToNetGUID.Find(FEntityOffset(ObjectRef.Entity, ObjectRef.Offset));
+	}
+
+	return UnrealObjectRefToNetGUID.Find(ObjectRef);
+}
+
+void FSpatialNetGUIDCache::AddObjectRefToNetGUID(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID)
+{
+	if (IsEntityObjectRef(ObjectRef))
+	{
+		EntityOffsetToNetGUID.Emplace(FEntityOffset(ObjectRef.Entity, ObjectRef.Offset), NetGUID);
+	}
+	else
+	{
+		UnrealObjectRefToNetGUID.Emplace(ObjectRef, NetGUID);
+	}
+}
+
+void FSpatialNetGUIDCache::RemoveObjectRefToNetGUID(const FUnrealObjectRef& ObjectRef)
+{
+	if (IsEntityObjectRef(ObjectRef))
+	{
+		EntityOffsetToNetGUID.Remove(FEntityOffset(ObjectRef.Entity, ObjectRef.Offset));
+	}
+	else
+	{
+		UnrealObjectRefToNetGUID.Remove(ObjectRef);
+	}
+}
+
+void FSpatialNetGUIDCache::RemoveNetGUIDToObjectRef(const FNetworkGUID& NetGUID)
+{
+	NetGUIDToUnrealObjectRef.Remove(NetGUID);
+
+	if (const FNetGuidCacheObject* CacheObject = ObjectLookup.Find(NetGUID))
+	{
+		ObjectToEntityId.Remove(CacheObject->Object);
+	}
 }
@@ -531,6 +531,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 	{
 		TUniquePtr<FOutgoingMessage> OutgoingMessage;
 		OutgoingMessagesQueue.Dequeue(OutgoingMessage);
+		NumQueuedOutgoingMessages.Decrement();
 
 		switch (OutgoingMessage->Type)
 		{
@@ -720,4 +721,5 @@ void USpatialWorkerConnection::QueueOutgoingMessage(ArgsType&&... Args)
 	// TODO UNR-1271: As later optimization, we can change the queue to hold a union
 	// of all outgoing message types, rather than having a pointer.
 	OutgoingMessagesQueue.Enqueue(MakeUnique<T>(Forward<ArgsType>(Args)...));
+	NumQueuedOutgoingMessages.Increment();
 }
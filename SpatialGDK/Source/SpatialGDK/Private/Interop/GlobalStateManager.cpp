@@ -84,6 +84,14 @@ void UGlobalStateManager::ApplyStartupActorManagerData(const Worker_ComponentDat
 	ApplyCanBeginPlayUpdate(bCanBeginPlayData);
 }
 
+void UGlobalStateManager::ApplyActorGroupAssignmentsData(const Worker_ComponentData& Data)
+{
+	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+
+	OffloadedActorGroupToWorkerType = GetStringToStringMapFromSchema(ComponentObject, SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_OFFLOADED_ACTOR_GROUP_TO_WORKER_TYPE_ID);
+	NetDriver->ApplyActorGroupAssignments(OffloadedActorGroupToWorkerType);
+}
+
 void UGlobalStateManager::ApplySingletonManagerUpdate(const Worker_ComponentUpdate& Update)
 {
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
@@ -209,6 +217,12 @@ void UGlobalStateManager::ApplyStartupActorManagerUpdate(const Worker_ComponentU
 	}
 }
 
+void UGlobalStateManager::ApplyActorGroupAssignmentsUpdate(const Worker_ComponentUpdate& Update)
+{
+	OffloadedActorGroupToWorkerType = GetOffloadedActorGroupsFromUpdate(Update);
+	NetDriver->ApplyActorGroupAssignments(OffloadedActorGroupToWorkerType);
+}
+
 void UGlobalStateManager::ApplyCanBeginPlayUpdate(const bool bCanBeginPlayUpdate)
 {
 	bCanBeginPlay = bCanBeginPlayUpdate;
@@ -447,6 +461,100 @@ void UGlobalStateManager::SetCanBeginPlay(const bool bInCanBeginPlay)
 	NetDriver->Connection->SendComponentUpdate(GlobalStateManagerEntityId, &Update);
 }
 
+void UGlobalStateManager::SetOffloadedActorGroups(const StringToStringMap& InOffloadedActorGroupToWorkerType)
+{
+	check(HasActorGroupAssignmentsAuthority());
+
+	Worker_ComponentUpdate Update = CreateActorGroupAssignmentsUpdate(InOffloadedActorGroupToWorkerType);
+
+	// Component updates are short circuited so we apply the assignments here and then send the component update.
+	OffloadedActorGroupToWorkerType = InOffloadedActorGroupToWorkerType;
+	NetDriver->ApplyActorGroupAssignments(OffloadedActorGroupToWorkerType);
+	NetDriver->Connection->SendComponentUpdate(GlobalStateManagerEntityId, &Update);
+}
+
+Worker_ComponentUpdate UGlobalStateManager::CreateActorGroupAssignmentsUpdate(const StringToStringMap& InOffloadedActorGroupToWorkerType)
+{
+	Worker_ComponentUpdate Update = {};
+	Update.component_id = SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID;
+	Update.schema_type = Schema_CreateComponentUpdate(SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID);
+	Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+	if (InOffloadedActorGroupToWorkerType.Num() > 0)
+	{
+		AddStringToStringMapToSchema(UpdateObject, SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_OFFLOADED_ACTOR_GROUP_TO_WORKER_TYPE_ID, InOffloadedActorGroupToWorkerType);
+	}
+	else
+	{
+		Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_OFFLOADED_ACTOR_GROUP_TO_WORKER_TYPE_ID);
+	}
+
+	return Update;
+}
+
+StringToStringMap UGlobalStateManager::GetOffloadedActorGroupsFromUpdate(const Worker_ComponentUpdate& Update)
+{
+	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+	// The whole map is sent with each update, and an empty map is sent as a cleared field.
+	return GetStringToStringMapFromSchema(ComponentObject, SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_OFFLOADED_ACTOR_GROUP_TO_WORKER_TYPE_ID);
+}
+
+void UGlobalStateManager::SendWorkerLoadReport(FName WorkerType, double Load, const TArray<FString>& OwnedActorGroups)
+{
+	Worker_CommandRequest CommandRequest = CreateWorkerLoadReportRequest(WorkerType, Load, OwnedActorGroups);
+	NetDriver->Connection->SendCommandRequest(GlobalStateManagerEntityId, &CommandRequest, SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_REPORT_WORKER_LOAD_COMMAND_ID);
+}
+
+void UGlobalStateManager::ReceiveWorkerLoadReport(Schema_Object* Payload, const char* CallerWorkerAttribute)
+{
+	if (NetDriver->ActorGroupManager == nullptr)
+	{
+		return;
+	}
+
+	FName WorkerType;
+	double Load;
+	TArray<FString> OwnedActorGroups;
+	ReadWorkerLoadReport(Payload, WorkerType, Load, OwnedActorGroups);
+
+	NetDriver->ActorGroupManager->ReportWorkerLoad(UTF8_TO_TCHAR(CallerWorkerAttribute), WorkerType, Load, OwnedActorGroups, FPlatformTime::Seconds());
+}
+
+Worker_CommandRequest UGlobalStateManager::CreateWorkerLoadReportRequest(FName WorkerType, double Load, const TArray<FString>& OwnedActorGroups)
+{
+	Worker_CommandRequest CommandRequest = {};
+	CommandRequest.component_id = SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID;
+	CommandRequest.schema_type = Schema_CreateCommandRequest(SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID, SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_REPORT_WORKER_LOAD_COMMAND_ID);
+	Schema_Object* RequestObject = Schema_GetCommandRequestObject(CommandRequest.schema_type);
+
+	AddStringToSchema(RequestObject, SpatialConstants::REPORT_WORKER_LOAD_WORKER_TYPE_ID, WorkerType.ToString());
+	Schema_AddDouble(RequestObject, SpatialConstants::REPORT_WORKER_LOAD_LOAD_ID, Load);
+	for (const FString& ActorGroup : OwnedActorGroups)
+	{
+		AddStringToSchema(RequestObject, SpatialConstants::REPORT_WORKER_LOAD_OWNED_ACTOR_GROUPS_ID, ActorGroup);
+	}
+
+	return CommandRequest;
+}
+
+void UGlobalStateManager::ReadWorkerLoadReport(Schema_Object* Payload, FName& OutWorkerType, double& OutLoad, TArray<FString>& OutOwnedActorGroups)
+{
+	OutWorkerType = FName(*GetStringFromSchema(Payload, SpatialConstants::REPORT_WORKER_LOAD_WORKER_TYPE_ID));
+	OutLoad = Schema_GetDouble(Payload, SpatialConstants::REPORT_WORKER_LOAD_LOAD_ID);
+
+	const uint32 NumOwnedActorGroups = Schema_GetBytesCount(Payload, SpatialConstants::REPORT_WORKER_LOAD_OWNED_ACTOR_GROUPS_ID);
+	for (uint32 Index = 0; Index < NumOwnedActorGroups; Index++)
+	{
+		OutOwnedActorGroups.Add(IndexStringFromSchema(Payload, SpatialConstants::REPORT_WORKER_LOAD_OWNED_ACTOR_GROUPS_ID, Index));
+	}
+}
+
+bool UGlobalStateManager::HasActorGroupAssignmentsAuthority() const
+{
+	return StaticComponentView->HasAuthority(GlobalStateManagerEntityId, SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID);
+}
+
 void UGlobalStateManager::AuthorityChanged(const Worker_AuthorityChangeOp& AuthOp)
 {
 	UE_LOG(LogGlobalStateManager, Verbose, TEXT("Authority over the GSM component %d has changed. This worker %s authority."), AuthOp.component_id,
@@ -497,6 +605,7 @@ bool UGlobalStateManager::HandlesComponent(const Worker_ComponentId ComponentId)
 		case SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID:
 		case SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID:
 		case SpatialConstants::GSM_SHUTDOWN_COMPONENT_ID:
+		case SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID:
 			return true;
 		default:
 			return false;
@@ -3,12 +3,15 @@
 #include "Interop/SpatialClassInfoManager.h"
 
 #include "AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/Engine.h"
 #include "GameFramework/Actor.h"
 #include "Misc/MessageDialog.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "UObject/Class.h"
+#include "UObject/EnumProperty.h"
 #include "UObject/UObjectIterator.h"
 
 #if WITH_EDITOR
@@ -37,6 +40,21 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver, UActorGro
 		return false;
 	}
 
+	// The compact schema database is rebuilt in the editor, so class paths are referred to by index along with the build they belong to.
+	const int32 NumGeneratedComponentIds = FMath::Max(static_cast<int32>(SchemaDatabase->NextAvailableComponentId) - static_cast<int32>(SpatialConstants::STARTING_GENERATED_COMPONENT_ID), 0);
+	GeneratedComponentIdInfos.Empty(NumGeneratedComponentIds);
+	GeneratedComponentIdInfos.SetNum(NumGeneratedComponentIds);
+	GeneratedComponentIdClassPathIndices.Empty(NumGeneratedComponentIds);
+	GeneratedComponentIdClassPathIndices.Init(INDEX_NONE, NumGeneratedComponentIds);
+	SchemaDatabase->GetCompactSchemaDatabase().ForEachComponentIdClassPathIndex([this](Worker_ComponentId ComponentId, int32 ClassPathIndex)
+	{
+		if (IsGeneratedComponentIdInDenseRange(ComponentId))
+		{
+			GeneratedComponentIdClassPathIndices[ComponentId - SpatialConstants::STARTING_GENERATED_COMPONENT_ID] = ClassPathIndex;
+		}
+	});
+	GeneratedComponentIdClassPathsGeneration = SchemaDatabase->GetCompactSchemaDatabase().GetBuildGeneration();
+
 	return true;
 }
 
@@ -52,6 +70,107 @@ FORCEINLINE UClass* ResolveClass(FString& ClassPath)
 	return Class;
 }
 
+// Whether Identical for this property is equivalent to comparing its memory, and CopySingleValue to copying it.
+bool IsHandoverPropertyMemoryComparable(const UProperty* Property)
+{
+	if (Property->IsA<UBoolProperty>())
+	{
+		// Bitfield bools share their bytes with other properties.
+		return false;
+	}
+
+	if (Property->IsA<UFloatProperty>() || Property->IsA<UDoubleProperty>())
+	{
+		// Identical treats -0.0 and 0.0 as equal, and a NaN as different from itself.
+		return false;
+	}
+
+	if (Property->IsA<UNumericProperty>() || Property->IsA<UEnumProperty>() || Property->IsA<UObjectProperty>())
+	{
+		return true;
+	}
+
+	if (const UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		const UScriptStruct* Struct = StructProperty->Struct;
+		if (Struct->StructFlags & (STRUCT_IdenticalNative | STRUCT_CopyNative))
+		{
+			return false;
+		}
+
+		// Padding bytes could differ between otherwise identical values.
+		int32 MemberSize = 0;
+		for (TFieldIterator<UProperty> It(Struct); It; ++It)
+		{
+			if (!IsHandoverPropertyMemoryComparable(*It))
+			{
+				return false;
+			}
+			MemberSize += It->GetSize();
+		}
+
+		return MemberSize == Struct->GetStructureSize();
+	}
+
+	return false;
+}
+
+void BuildHandoverShadowLayout(FClassInfo& Info)
+{
+	int32 ShadowDataSize = 0;
+
+	for (int32 i = 0; i < Info.HandoverProperties.Num(); i++)
+	{
+		FHandoverPropertyInfo& PropertyInfo = Info.HandoverProperties[i];
+		const bool bMemoryComparable = IsHandoverPropertyMemoryComparable(PropertyInfo.Property);
+
+		if (bMemoryComparable)
+		{
+			// Memory comparable data is only ever accessed with memcmp and memcpy, so it doesn't need to be aligned.
+			FHandoverShadowSpan* Span = Info.HandoverShadowSpans.Num() > 0 ? &Info.HandoverShadowSpans.Last() : nullptr;
+			if (Span == nullptr || !Span->bMemoryComparable || Span->Offset + Span->Size != PropertyInfo.Offset)
+			{
+				Span = &Info.HandoverShadowSpans.AddDefaulted_GetRef();
+				Span->Offset = PropertyInfo.Offset;
+				Span->ShadowOffset = ShadowDataSize;
+				Span->Size = 0;
+				Span->FirstProperty = i;
+				Span->NumProperties = 0;
+				Span->bMemoryComparable = true;
+			}
+
+			PropertyInfo.ShadowOffset = ShadowDataSize;
+			ShadowDataSize += PropertyInfo.Property->ElementSize;
+
+			Span->Size += PropertyInfo.Property->ElementSize;
+			Span->NumProperties++;
+			continue;
+		}
+
+		// Static arrays are initialized and destroyed as a whole through their first element, so the elements must stay contiguous.
+		if (PropertyInfo.ArrayIdx == 0)
+		{
+			ShadowDataSize = Align(ShadowDataSize, PropertyInfo.Property->GetMinAlignment());
+			PropertyInfo.ShadowOffset = ShadowDataSize;
+			ShadowDataSize += PropertyInfo.Property->GetSize();
+		}
+		else
+		{
+			PropertyInfo.ShadowOffset = Info.HandoverProperties[i - PropertyInfo.ArrayIdx].ShadowOffset + PropertyInfo.Property->ElementSize * PropertyInfo.ArrayIdx;
+		}
+
+		FHandoverShadowSpan& Span = Info.HandoverShadowSpans.AddDefaulted_GetRef();
+		Span.Offset = PropertyInfo.Offset;
+		Span.ShadowOffset = PropertyInfo.ShadowOffset;
+		Span.Size = PropertyInfo.Property->ElementSize;
+		Span.FirstProperty = i;
+		Span.NumProperties = 1;
+		Span.bMemoryComparable = false;
+	}
+
+	Info.HandoverShadowDataSize = ShadowDataSize;
+}
+
 ESchemaComponentType GetRPCType(UFunction* RemoteFunction)
 {
 	if (RemoteFunction->HasAnyFunctionFlags(FUNC_NetMulticast))
@@ -88,23 +207,10 @@ ESchemaComponentType GetRPCType(UFunction* RemoteFunction)
 	return SCHEMA_Invalid;
 }
 
-void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
+// Extracts the RPC, handover and interest metadata of a class. Only reads reflection data, so it can run off the game thread.
+void BuildClassMetadata(UClass* Class, bool bEnableHandover, FClassInfo& OutInfo)
 {
-	// Remove PIE prefix on class if it exists to properly look up the class.
-	FString ClassPath = Class->GetPathName();
-	GEngine->NetworkRemapPath(NetDriver, ClassPath, false);
-
-	TSharedRef<FClassInfo> Info = ClassInfoMap.Add(Class, MakeShared<FClassInfo>());
-	Info->Class = Class;
-
-	// Note: we have to add Class to ClassInfoMap before quitting, as it is expected to be in there by GetOrCreateClassInfoByClass. Therefore the quitting logic cannot be moved higher up.
-	if (!IsSupportedClass(ClassPath))
-	{
-		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Could not find class %s in schema database. Double-check whether replication is enabled for this class, the class is explicitly referenced from the starting scene and schema has been generated."), *ClassPath);
-		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Disconnecting due to no generated schema for %s."), *ClassPath);
-		QuitGame();
-		return;
-	}
+	OutInfo.Class = Class;
 
 	TArray<UFunction*> RelevantClassFunctions = SpatialGDK::GetClassRPCFunctions(Class);
 
@@ -117,14 +223,12 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		RPCInfo.Type = RPCType;
 
 		// Index is guaranteed to be the same on Clients & Servers since we process remote functions in the same order.
-		RPCInfo.Index = Info->RPCs.Num();
+		RPCInfo.Index = OutInfo.RPCs.Num();
 
-		Info->RPCs.Add(RemoteFunction);
-		Info->RPCInfoMap.Add(RemoteFunction, RPCInfo);
+		OutInfo.RPCs.Add(RemoteFunction);
+		OutInfo.RPCInfoMap.Add(RemoteFunction, RPCInfo);
 	}
 
-	const bool bEnableHandover = GetDefault<USpatialGDKSettings>()->bEnableHandover;
-
 	for (TFieldIterator<UProperty> PropertyIt(Class); PropertyIt; ++PropertyIt)
 	{
 		UProperty* Property = *PropertyIt;
@@ -134,12 +238,12 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 			for (int32 ArrayIdx = 0; ArrayIdx < PropertyIt->ArrayDim; ++ArrayIdx)
 			{
 				FHandoverPropertyInfo HandoverInfo;
-				HandoverInfo.Handle = Info->HandoverProperties.Num() + 1; // 1-based index
+				HandoverInfo.Handle = OutInfo.HandoverProperties.Num() + 1; // 1-based index
 				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
 				HandoverInfo.ArrayIdx = ArrayIdx;
 				HandoverInfo.Property = Property;
 
-				Info->HandoverProperties.Add(HandoverInfo);
+				OutInfo.HandoverProperties.Add(HandoverInfo);
 			}
 		}
 
@@ -151,13 +255,41 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 				InterestInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
 				InterestInfo.Property = Property;
 
-				Info->InterestProperties.Add(InterestInfo);
+				OutInfo.InterestProperties.Add(InterestInfo);
 			}
 		}
 	}
 
+	BuildHandoverShadowLayout(OutInfo);
+}
+
+void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
+{
+	TSharedRef<FClassInfo> Info = MakeShared<FClassInfo>();
+	BuildClassMetadata(Class, GetDefault<USpatialGDKSettings>()->bEnableHandover, Info.Get());
+	AddClassInfoForClass(Class, Info);
+}
+
+void USpatialClassInfoManager::AddClassInfoForClass(UClass* Class, TSharedRef<FClassInfo> Info)
+{
+	// Remove PIE prefix on class if it exists to properly look up the class.
+	FString ClassPath = Class->GetPathName();
+	GEngine->NetworkRemapPath(NetDriver, ClassPath, false);
+
+	ClassInfoMap.Add(Class, Info);
+
+	// Note: we have to add Class to ClassInfoMap before quitting, as it is expected to be in there by GetOrCreateClassInfoByClass. Therefore the quitting logic cannot be moved higher up.
+	if (!IsSupportedClass(ClassPath))
+	{
+		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Could not find class %s in schema database. Double-check whether replication is enabled for this class, the class is explicitly referenced from the starting scene and schema has been generated."), *ClassPath);
+		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Disconnecting due to no generated schema for %s."), *ClassPath);
+		QuitGame();
+		return;
+	}
+
 	if (Class->IsChildOf<AActor>())
 	{
+		InterestDistances.AddClass(Class);
 		FinishConstructingActorClassInfo(ClassPath, Info);
 	}
 	else
@@ -168,9 +300,12 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 
 void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
+	const FActorSchemaData* ActorSchemaData = SchemaDatabase->GetCompactSchemaDatabase().FindActorSchemaData(ClassPath);
+	check(ActorSchemaData != nullptr);
+
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
 	{
-		Worker_ComponentId ComponentId = SchemaDatabase->ActorClassPathToSchema[ClassPath].SchemaComponents[Type];
+		Worker_ComponentId ComponentId = ActorSchemaData->SchemaComponents[Type];
 
 		if (!GetDefault<USpatialGDKSettings>()->bEnableHandover && Type == SCHEMA_Handover)
 		{
@@ -180,13 +315,11 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 		if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			Info->SchemaComponents[Type] = ComponentId;
-			ComponentToClassInfoMap.Add(ComponentId, Info);
-			ComponentToOffsetMap.Add(ComponentId, 0);
-			ComponentToCategoryMap.Add(ComponentId, (ESchemaComponentType)Type);
+			AddComponentIdInfo(ComponentId, Info, 0, (ESchemaComponentType)Type);
 		}
 	});
 
-	for (auto& SubobjectClassDataPair : SchemaDatabase->ActorClassPathToSchema[ClassPath].SubobjectData)
+	for (auto& SubobjectClassDataPair : ActorSchemaData->SubobjectData)
 	{
 		int32 Offset = SubobjectClassDataPair.Key;
 		FActorSpecificSubobjectSchemaData SubobjectSchemaData = SubobjectClassDataPair.Value;
@@ -215,21 +348,22 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 			if (ComponentId != 0)
 			{
 				ActorSubobjectInfo->SchemaComponents[Type] = ComponentId;
-				ComponentToClassInfoMap.Add(ComponentId, ActorSubobjectInfo);
-				ComponentToOffsetMap.Add(ComponentId, Offset);
-				ComponentToCategoryMap.Add(ComponentId, ESchemaComponentType(Type));
+				AddComponentIdInfo(ComponentId, ActorSubobjectInfo, Offset, ESchemaComponentType(Type));
 			}
 		});
 
 		Info->SubobjectInfo.Add(Offset, ActorSubobjectInfo);
+		Info->SubobjectNameToOffset.Add(ActorSubobjectInfo->SubobjectName, Offset);
 	}
 
 	if (UClass* ActorClass = Info->Class.Get())
 	{
 		if (ActorClass->IsChildOf<AActor>())
 		{
-			Info->ActorGroup = ActorGroupManager->GetActorGroupForClass(TSubclassOf<AActor>(ActorClass));
-			Info->WorkerType = ActorGroupManager->GetWorkerTypeForClass(TSubclassOf<AActor>(ActorClass));
+			const FActorGroupAssignment ActorGroupAssignment = ActorGroupManager->GetActorGroupAssignmentForClass(TSubclassOf<AActor>(ActorClass));
+			Info->ActorGroup = ActorGroupAssignment.ActorGroup;
+			Info->WorkerType = ActorGroupManager->GetWorkerTypeByIndex(ActorGroupAssignment.WorkerTypeIndex);
+			Info->WorkerTypeIndex = ActorGroupAssignment.WorkerTypeIndex;
 
 			UE_LOG(LogSpatialClassInfoManager, VeryVerbose, TEXT("[%s] is in ActorGroup [%s], on WorkerType [%s]"),
 				*ActorClass->GetPathName(), *Info->ActorGroup.ToString(), *Info->WorkerType.ToString())
@@ -239,7 +373,10 @@ void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& C
 
 void USpatialClassInfoManager::FinishConstructingSubobjectClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
-	for (const auto& DynamicSubobjectData : SchemaDatabase->SubobjectClassPathToSchema[ClassPath].DynamicSubobjectComponents)
+	const FSubobjectSchemaData* SubobjectSchemaData = SchemaDatabase->GetCompactSchemaDatabase().FindSubobjectSchemaData(ClassPath);
+	check(SubobjectSchemaData != nullptr);
+
+	for (const auto& DynamicSubobjectData : SubobjectSchemaData->DynamicSubobjectComponents)
 	{
 		// Make a copy of the already made FClassInfo for this dynamic subobject
 		TSharedRef<FClassInfo> SpecificDynamicSubobjectInfo = MakeShared<FClassInfo>(Info.Get());
@@ -254,9 +391,7 @@ void USpatialClassInfoManager::FinishConstructingSubobjectClassInfo(const FStrin
 			if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
 			{
 				SpecificDynamicSubobjectInfo->SchemaComponents[Type] = ComponentId;
-				ComponentToClassInfoMap.Add(ComponentId, SpecificDynamicSubobjectInfo);
-				ComponentToOffsetMap.Add(ComponentId, Offset);
-				ComponentToCategoryMap.Add(ComponentId, ESchemaComponentType(Type));
+				AddComponentIdInfo(ComponentId, SpecificDynamicSubobjectInfo, Offset, ESchemaComponentType(Type));
 			}
 		});
 
@@ -264,9 +399,61 @@ void USpatialClassInfoManager::FinishConstructingSubobjectClassInfo(const FStrin
 	}
 }
 
+bool USpatialClassInfoManager::IsGeneratedComponentIdInDenseRange(Worker_ComponentId ComponentId) const
+{
+	return ComponentId >= SpatialConstants::STARTING_GENERATED_COMPONENT_ID
+		&& ComponentId - SpatialConstants::STARTING_GENERATED_COMPONENT_ID < static_cast<Worker_ComponentId>(GeneratedComponentIdInfos.Num());
+}
+
+void USpatialClassInfoManager::AddComponentIdInfo(Worker_ComponentId ComponentId, const TSharedRef<FClassInfo>& Info, uint32 Offset, ESchemaComponentType Category)
+{
+	FComponentIdInfo& ComponentIdInfo = IsGeneratedComponentIdInDenseRange(ComponentId)
+		? GeneratedComponentIdInfos[ComponentId - SpatialConstants::STARTING_GENERATED_COMPONENT_ID]
+		: ComponentIdInfoMap.FindOrAdd(ComponentId);
+
+	ComponentIdInfo.ClassInfo = Info;
+	ComponentIdInfo.Offset = Offset;
+	ComponentIdInfo.Category = Category;
+}
+
+const USpatialClassInfoManager::FComponentIdInfo* USpatialClassInfoManager::FindComponentIdInfo(Worker_ComponentId ComponentId) const
+{
+	if (IsGeneratedComponentIdInDenseRange(ComponentId))
+	{
+		const FComponentIdInfo& ComponentIdInfo = GeneratedComponentIdInfos[ComponentId - SpatialConstants::STARTING_GENERATED_COMPONENT_ID];
+		return ComponentIdInfo.ClassInfo.IsValid() ? &ComponentIdInfo : nullptr;
+	}
+
+	return ComponentIdInfoMap.Find(ComponentId);
+}
+
+const USpatialClassInfoManager::FComponentIdInfo* USpatialClassInfoManager::FindOrCreateComponentIdInfo(Worker_ComponentId ComponentId)
+{
+	if (const FComponentIdInfo* ComponentIdInfo = FindComponentIdInfo(ComponentId))
+	{
+		return ComponentIdInfo;
+	}
+
+	TryCreateClassInfoForComponentId(ComponentId);
+	return FindComponentIdInfo(ComponentId);
+}
+
+const FString* USpatialClassInfoManager::FindClassPathForComponentId(Worker_ComponentId ComponentId) const
+{
+	const FCompactSchemaDatabase& CompactSchemaDatabase = SchemaDatabase->GetCompactSchemaDatabase();
+	if (IsGeneratedComponentIdInDenseRange(ComponentId) && CompactSchemaDatabase.GetBuildGeneration() == GeneratedComponentIdClassPathsGeneration)
+	{
+		const int32 ClassPathIndex = GeneratedComponentIdClassPathIndices[ComponentId - SpatialConstants::STARTING_GENERATED_COMPONENT_ID];
+		return ClassPathIndex != INDEX_NONE ? &CompactSchemaDatabase.GetClassPath(ClassPathIndex) : nullptr;
+	}
+
+	// The database was rebuilt since the indices were taken, e.g. by schema generation in the editor.
+	return CompactSchemaDatabase.FindClassPathForComponentId(ComponentId);
+}
+
 void USpatialClassInfoManager::TryCreateClassInfoForComponentId(Worker_ComponentId ComponentId)
 {
-	if (FString* ClassPath = SchemaDatabase->ComponentIdToClassPath.Find(ComponentId))
+	if (const FString* ClassPath = FindClassPathForComponentId(ComponentId))
 	{
 		if (UClass* Class = LoadObject<UClass>(nullptr, **ClassPath))
 		{
@@ -277,7 +464,8 @@ void USpatialClassInfoManager::TryCreateClassInfoForComponentId(Worker_Component
 
 bool USpatialClassInfoManager::IsSupportedClass(const FString& PathName) const
 {
-	return SchemaDatabase->ActorClassPathToSchema.Contains(PathName) || SchemaDatabase->SubobjectClassPathToSchema.Contains(PathName);
+	const FCompactSchemaDatabase& CompactSchemaDatabase = SchemaDatabase->GetCompactSchemaDatabase();
+	return CompactSchemaDatabase.FindActorSchemaData(PathName) != nullptr || CompactSchemaDatabase.FindSubobjectSchemaData(PathName) != nullptr;
 }
 
 const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByClass(UClass* Class)
@@ -304,24 +492,24 @@ const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByObject(UObject
 
 		check(ObjectRef.IsValid());
 
-		return ComponentToClassInfoMap[ObjectRef.Offset].Get();
+		const FComponentIdInfo* ComponentIdInfo = FindComponentIdInfo(ObjectRef.Offset);
+		check(ComponentIdInfo != nullptr);
+		return *ComponentIdInfo->ClassInfo;
 	}
 }
 
 const FClassInfo& USpatialClassInfoManager::GetClassInfoByComponentId(Worker_ComponentId ComponentId)
 {
-	if (!ComponentToClassInfoMap.Contains(ComponentId))
-	{
-		TryCreateClassInfoForComponentId(ComponentId);
-	}
-
-	TSharedRef<FClassInfo> Info = ComponentToClassInfoMap.FindChecked(ComponentId);
-	return Info.Get();
+	const FComponentIdInfo* ComponentIdInfo = FindOrCreateComponentIdInfo(ComponentId);
+	check(ComponentIdInfo != nullptr);
+	return *ComponentIdInfo->ClassInfo;
 }
 
 UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId ComponentId)
 {
-	TSharedRef<FClassInfo> Info = ComponentToClassInfoMap.FindChecked(ComponentId);
+	const FComponentIdInfo* ComponentIdInfo = FindComponentIdInfo(ComponentId);
+	check(ComponentIdInfo != nullptr);
+	TSharedRef<FClassInfo> Info = ComponentIdInfo->ClassInfo.ToSharedRef();
 	if (UClass* Class = Info->Class.Get())
 	{
 		return Class;
@@ -333,7 +521,7 @@ UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId Compo
 		// The weak pointer to the class stored in the FClassInfo will be the same as the one used as the key in ClassInfoMap, so we can use it to clean up the old entry.
 		ClassInfoMap.Remove(Info->Class);
 
-		// The old references in the other maps (ComponentToClassInfoMap etc) will be replaced by reloading the info (as a part of LoadClassForComponent).
+		// The old references in the component ID lookups will be replaced by reloading the info (as a part of LoadClassForComponent).
 	}
 
 	return nullptr;
@@ -342,7 +530,7 @@ UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId Compo
 uint32 USpatialClassInfoManager::GetComponentIdForClass(const UClass& Class) const
 {
 	const FString ClassPath = Class.GetPathName();
-	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(Class.GetPathName()))
+	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->GetCompactSchemaDatabase().FindActorSchemaData(ClassPath))
 	{
 		return ActorSchemaData->SchemaComponents[SCHEMA_Data];
 	}
@@ -386,14 +574,9 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 
 bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset)
 {
-	if (!ComponentToOffsetMap.Contains(ComponentId))
-	{
-		TryCreateClassInfoForComponentId(ComponentId);
-	}
-
-	if (uint32* Offset = ComponentToOffsetMap.Find(ComponentId))
+	if (const FComponentIdInfo* ComponentIdInfo = FindOrCreateComponentIdInfo(ComponentId))
 	{
-		OutOffset = *Offset;
+		OutOffset = ComponentIdInfo->Offset;
 		return true;
 	}
 
@@ -402,14 +585,9 @@ bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId Compone
 
 ESchemaComponentType USpatialClassInfoManager::GetCategoryByComponentId(Worker_ComponentId ComponentId)
 {
-	if (!ComponentToCategoryMap.Contains(ComponentId))
+	if (const FComponentIdInfo* ComponentIdInfo = FindOrCreateComponentIdInfo(ComponentId))
 	{
-		TryCreateClassInfoForComponentId(ComponentId);
-	}
-
-	if (ESchemaComponentType* Category = ComponentToCategoryMap.Find(ComponentId))
-	{
-		return *Category;
+		return ComponentIdInfo->Category;
 	}
 
 	return ESchemaComponentType::SCHEMA_Invalid;
@@ -443,16 +621,108 @@ const FRPCInfo& USpatialClassInfoManager::GetRPCInfo(UObject* Object, UFunction*
 uint32 USpatialClassInfoManager::GetComponentIdFromLevelPath(const FString& LevelPath)
 {
 	FString CleanLevelPath = UWorld::RemovePIEPrefix(LevelPath);
-	if (const uint32* ComponentId = SchemaDatabase->LevelPathToComponentId.Find(CleanLevelPath))
+	return SchemaDatabase->GetCompactSchemaDatabase().GetComponentIdForLevelPath(CleanLevelPath);
+}
+
+bool USpatialClassInfoManager::IsSublevelComponent(Worker_ComponentId ComponentId)
+{
+	return SchemaDatabase->GetCompactSchemaDatabase().IsLevelComponent(ComponentId);
+}
+
+void USpatialClassInfoManager::UpdateWorkerTypeForActorGroup(FName ActorGroup)
+{
+	const int32 WorkerTypeIndex = ActorGroupManager->GetWorkerTypeIndexForActorGroup(ActorGroup);
+	const FName WorkerType = ActorGroupManager->GetWorkerTypeByIndex(WorkerTypeIndex);
+
+	for (auto& ClassInfoPair : ClassInfoMap)
 	{
-		return *ComponentId;
+		FClassInfo& Info = ClassInfoPair.Value.Get();
+		if (Info.ActorGroup == ActorGroup)
+		{
+			Info.WorkerType = WorkerType;
+			Info.WorkerTypeIndex = WorkerTypeIndex;
+		}
 	}
-	return SpatialConstants::INVALID_COMPONENT_ID;
 }
 
-bool USpatialClassInfoManager::IsSublevelComponent(Worker_ComponentId ComponentId)
+void USpatialClassInfoManager::StartClassInfoWarmUp()
+{
+	const FCompactSchemaDatabase& CompactSchemaDatabase = SchemaDatabase->GetCompactSchemaDatabase();
+	ClassInfoWarmUpPaths.Reset(CompactSchemaDatabase.GetNumSubobjectClasses() + CompactSchemaDatabase.GetNumActorClasses());
+	ClassInfoWarmUpIndex = 0;
+
+	CompactSchemaDatabase.ForEachSubobjectClassPath([this](const FString& ClassPath)
+	{
+		ClassInfoWarmUpPaths.Add(ClassPath);
+	});
+
+	CompactSchemaDatabase.ForEachActorClassPath([this](const FString& ClassPath)
+	{
+		ClassInfoWarmUpPaths.Add(ClassPath);
+	});
+
+	UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Warming up class info for up to %d classes."), ClassInfoWarmUpPaths.Num());
+}
+
+void USpatialClassInfoManager::TickClassInfoWarmUp(float BudgetMs)
+{
+	if (!IsClassInfoWarmUpInProgress())
+	{
+		return;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + BudgetMs / 1000.0;
+	const bool bEnableHandover = GetDefault<USpatialGDKSettings>()->bEnableHandover;
+	const int32 BatchSize = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1) * 2;
+
+	TArray<UClass*> Classes;
+	TArray<TSharedRef<FClassInfo>> Infos;
+
+	do
+	{
+		Classes.Reset();
+		Infos.Reset();
+
+		while (Classes.Num() < BatchSize && IsClassInfoWarmUpInProgress())
+		{
+			// Only resolve classes that are already loaded. Loading them here would cause the hitches this is meant to avoid.
+			UClass* Class = FSoftClassPath(ClassInfoWarmUpPaths[ClassInfoWarmUpIndex++]).ResolveClass();
+			if (Class != nullptr && !ClassInfoMap.Contains(Class))
+			{
+				Classes.Add(Class);
+				Infos.Add(MakeShared<FClassInfo>());
+			}
+		}
+
+		ParallelFor(Classes.Num(), [&Classes, &Infos, bEnableHandover](int32 Index)
+		{
+			BuildClassMetadata(Classes[Index], bEnableHandover, Infos[Index].Get());
+		});
+
+		// Looking up schema components and subobjects touches the schema database and other class infos, so it stays on the game thread.
+		for (int32 i = 0; i < Classes.Num(); i++)
+		{
+			// An Actor class earlier in the batch may have already built this as one of its subobjects.
+			if (!ClassInfoMap.Contains(Classes[i]))
+			{
+				AddClassInfoForClass(Classes[i], Infos[i]);
+			}
+		}
+	} while (IsClassInfoWarmUpInProgress() && FPlatformTime::Seconds() < EndTime);
+
+	if (IsClassInfoWarmUpInProgress())
+	{
+		UE_LOG(LogSpatialClassInfoManager, Verbose, TEXT("Class info warm-up %.0f%% complete."), GetClassInfoWarmUpProgress() * 100.0f);
+	}
+	else
+	{
+		UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Class info warm-up complete, %d classes have class info."), ClassInfoMap.Num());
+	}
+}
+
+float USpatialClassInfoManager::GetClassInfoWarmUpProgress() const
 {
-	return SchemaDatabase->LevelComponentIds.Contains(ComponentId);
+	return ClassInfoWarmUpPaths.Num() > 0 ? static_cast<float>(ClassInfoWarmUpIndex) / ClassInfoWarmUpPaths.Num() : 1.0f;
 }
 
 void USpatialClassInfoManager::QuitGame()
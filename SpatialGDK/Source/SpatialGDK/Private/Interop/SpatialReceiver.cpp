@@ -133,6 +133,9 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 	case SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID:
 		GlobalStateManager->ApplyStartupActorManagerData(Op.data);
 		return;
+	case SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID:
+		GlobalStateManager->ApplyActorGroupAssignmentsData(Op.data);
+		return;
 	}
 
 	if (ClassInfoManager->IsSublevelComponent(Op.data.component_id))
@@ -202,6 +205,7 @@ void USpatialReceiver::ProcessRemoveComponent(const Worker_RemoveComponentOp& Op
 			if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
 			{
 				Channel->CreateSubObjects.Remove(Object);
+				Channel->bComponentInterestDirty = true;
 
 				Actor->OnSubobjectDestroyFromReplication(Object);
 
@@ -211,6 +215,19 @@ void USpatialReceiver::ProcessRemoveComponent(const Worker_RemoveComponentOp& Op
 				PackageMap->RemoveSubobject(FUnrealObjectRef(Op.entity_id, Op.component_id));
 			}
 		}
+		else if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
+		{
+			// The components of the Actor and its static subobjects are only removed while the entity stays checked out
+			// when the worker's interest stops including them, e.g. when the Actor moves into a client interest band without them.
+			// Their properties keep the last values received, and are updated again when the component is added back.
+			const ESchemaComponentType ComponentType = ClassInfoManager->GetCategoryByComponentId(Op.component_id);
+			if (ComponentType == SCHEMA_Data || ComponentType == SCHEMA_OwnerOnly || ComponentType == SCHEMA_Handover)
+			{
+				UE_LOG(LogSpatialReceiver, Verbose, TEXT("Entity: %lld Component: %d - Component removed from view, replicated properties of %s are stale until it's added back."),
+					Op.entity_id, Op.component_id, *Actor->GetName());
+				Channel->MarkComponentStale(Op.component_id);
+			}
+		}
 	}
 
 	StaticComponentView->OnRemoveComponent(Op);
@@ -301,6 +318,15 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 		HandlePlayerLifecycleAuthority(Op, PlayerController);
 	}
 
+	if (Op.component_id == SpatialConstants::INTEREST_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_AUTHORITATIVE)
+	{
+		// Another worker may have written the Interest since this one last sent it, so don't skip the next update.
+		if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
+		{
+			Channel->SentInterest.Reset();
+		}
+	}
+
 	if (NetDriver->IsServer())
 	{
 		// TODO UNR-955 - Remove this once batch reservation of EntityIds are in.
@@ -315,7 +341,8 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 		{
 			if (Op.authority == WORKER_AUTHORITY_AUTHORITATIVE)
 			{
-				if (IsValid(NetDriver->GetActorChannelByEntityId(Op.entity_id)))
+				USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id);
+				if (IsValid(Channel))
 				{
 					Actor->Role = ROLE_Authority;
 					Actor->RemoteRole = ROLE_SimulatedProxy;
@@ -334,7 +361,16 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 
 					UpdateShadowData(Op.entity_id);
 
+					// When load-aware offloading hands a group back, the owner may have changed while another worker type was authoritative,
+					// and only the EntityACL's worker can apply it.
+					if (StaticComponentView->HasAuthority(Op.entity_id, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
+					{
+						Sender->QueueOwnershipChange(Channel);
+					}
+
 					Actor->OnAuthorityGained();
+
+					NetDriver->AddActorToConsiderList(Actor);
 				}
 				else
 				{
@@ -909,6 +945,7 @@ void USpatialReceiver::ApplyComponentDataOnActorCreation(Worker_EntityId EntityI
 		PackageMap->ResolveSubobject(TargetObject.Get(), FUnrealObjectRef(EntityId, Offset));
 
 		Channel->CreateSubObjects.Add(TargetObject.Get());
+		Channel->bComponentInterestDirty = true;
 	}
 
 	ApplyComponentData(TargetObject.Get(), Channel, Data);
@@ -984,6 +1021,7 @@ void USpatialReceiver::AttachDynamicSubobject(Worker_EntityId EntityId, const FC
 	PackageMap->ResolveSubobject(Subobject, FUnrealObjectRef(EntityId, Info.SchemaComponents[SCHEMA_Data]));
 
 	Channel->CreateSubObjects.Add(Subobject);
+	Channel->bComponentInterestDirty = true;
 
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
 	{
@@ -1015,6 +1053,11 @@ void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorCh
 
 	FChannelObjectPair ChannelObjectPair(Channel, TargetObject);
 
+	if (Channel != nullptr)
+	{
+		Channel->ClearComponentStale(Data.component_id);
+	}
+
 	ESchemaComponentType ComponentType = ClassInfoManager->GetCategoryByComponentId(Data.component_id);
 
 	if (ComponentType == SCHEMA_Data || ComponentType == SCHEMA_OwnerOnly)
@@ -1096,6 +1139,9 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 	case SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID:
 		NetDriver->GlobalStateManager->ApplyStartupActorManagerUpdate(Op.update);
 		return;
+	case SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID:
+		NetDriver->GlobalStateManager->ApplyActorGroupAssignmentsUpdate(Op.update);
+		return;
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID:
@@ -1267,6 +1313,15 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 		Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
 		return;
 	}
+	else if (Op.request.component_id == SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID && CommandIndex == SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_REPORT_WORKER_LOAD_COMMAND_ID)
+	{
+		Schema_Object* Payload = Schema_GetCommandRequestObject(Op.request.schema_type);
+
+		// Loads are kept per worker, so the reports are keyed by the attribute of the specific worker that sent them.
+		NetDriver->GlobalStateManager->ReceiveWorkerLoadReport(Payload, Op.caller_attribute_set.attributes[1]);
+		Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
+		return;
+	}
 #if WITH_EDITOR
 	else if (Op.request.component_id == SpatialConstants::GSM_SHUTDOWN_COMPONENT_ID && CommandIndex == SpatialConstants::SHUTDOWN_MULTI_PROCESS_REQUEST_ID)
 	{
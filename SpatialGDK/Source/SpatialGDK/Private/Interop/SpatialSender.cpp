@@ -28,6 +28,7 @@
 #include "Utils/ComponentFactory.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/RepLayoutUtils.h"
+#include "Utils/SchemaUtils.h"
 #include "Utils/SpatialActorUtils.h"
 #include "Utils/SpatialMetrics.h"
 
@@ -70,56 +71,28 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 	TimerManager = InTimerManager;
 }
 
-Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
+Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel, int64& OutBytesWritten)
 {
 	AActor* Actor = Channel->Actor;
 	UClass* Class = Actor->GetClass();
 
 	FString ClientWorkerAttribute = GetOwnerWorkerAttribute(Actor);
-
-	WorkerRequirementSet AnyServerRequirementSet;
-	WorkerRequirementSet AnyServerOrClientRequirementSet = { SpatialConstants::UnrealClientAttributeSet };
-
 	WorkerAttributeSet OwningClientAttributeSet = { ClientWorkerAttribute };
-
-	WorkerRequirementSet AnyServerOrOwningClientRequirementSet = { OwningClientAttributeSet };
 	WorkerRequirementSet OwningClientOnlyRequirementSet = { OwningClientAttributeSet };
 
-	for (const FName& WorkerType : GetDefault<USpatialGDKSettings>()->ServerWorkerTypes)
-	{
-		WorkerAttributeSet ServerWorkerAttributeSet = { WorkerType.ToString() };
-
-		AnyServerRequirementSet.Add(ServerWorkerAttributeSet);
-		AnyServerOrClientRequirementSet.Add(ServerWorkerAttributeSet);
-		AnyServerOrOwningClientRequirementSet.Add(ServerWorkerAttributeSet);
-	}
-
-	WorkerRequirementSet ReadAcl;
-	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly))
-	{
-		ReadAcl = AnyServerRequirementSet;
-	}
-	else if (Actor->IsA<APlayerController>())
-	{
-		ReadAcl = AnyServerOrOwningClientRequirementSet;
-	}
-	else
-	{
-		ReadAcl = AnyServerOrClientRequirementSet;
-	}
-
 	const FClassInfo& Info = ClassInfoManager->GetOrCreateClassInfoByClass(Class);
+	const FEntityCreationTemplate& Template = GetOrCreateEntityCreationTemplate(Class, Info);
 
 	const WorkerAttributeSet WorkerAttribute{ Info.WorkerType.ToString() };
 	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { WorkerAttribute };
 
-	WriteAclMap ComponentWriteAcl;
-	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::SPAWN_DATA_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	WorkerRequirementSet ReadAcl = Template.ReadAcl;
+	if (Template.bIsPlayerController)
+	{
+		ReadAcl.Insert(OwningClientAttributeSet, 0);
+	}
+
+	WriteAclMap ComponentWriteAcl = Template.ComponentWriteAcl;
 	ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, OwningClientOnlyRequirementSet);
 
 	// If there are pending RPCs, add this component.
@@ -129,48 +102,24 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	}
 
 	// If Actor is a PlayerController, add the heartbeat component.
-	if (Actor->IsA<APlayerController>())
+	if (Template.bIsPlayerController)
 	{
-#if !UE_BUILD_SHIPPING
-		ComponentWriteAcl.Add(SpatialConstants::DEBUG_METRICS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-#endif // !UE_BUILD_SHIPPING
 		ComponentWriteAcl.Add(SpatialConstants::HEARTBEAT_COMPONENT_ID, OwningClientOnlyRequirementSet);
 	}
 
-	ComponentWriteAcl.Add(SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-
-	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
-	{
-		Worker_ComponentId ComponentId = Info.SchemaComponents[Type];
-		if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
-		{
-			return;
-		}
-
-		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
-	});
-
-	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
+	for (const TPair<uint32, TArray<Worker_ComponentId>>& SubobjectComponentIds : Template.StaticSubobjectComponentIds)
 	{
-		const FClassInfo& SubobjectInfo = SubobjectInfoPair.Value.Get();
-
 		// Static subobjects aren't guaranteed to exist on actor instances, check they are present before adding write acls
-		TWeakObjectPtr<UObject> Subobject = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(Channel->GetEntityId(), SubobjectInfoPair.Key));
+		TWeakObjectPtr<UObject> Subobject = PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(Channel->GetEntityId(), SubobjectComponentIds.Key));
 		if (!Subobject.IsValid())
 		{
 			continue;
 		}
 
-		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+		for (Worker_ComponentId ComponentId : SubobjectComponentIds.Value)
 		{
-			Worker_ComponentId ComponentId = SubobjectInfo.SchemaComponents[Type];
-			if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
-			{
-				return;
-			}
-
 			ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
-		});
+		}
 	}
 
 	// We want to have a stably named ref if this is a loaded Actor.
@@ -193,7 +142,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 		FString TempPath = Actor->GetFName().ToString();
 		GEngine->NetworkRemapPath(NetDriver, TempPath, false /*bIsReading*/);
 
-		StablyNamedObjectRef = FUnrealObjectRef(0, 0, TempPath, OuterObjectRef, true);
+		StablyNamedObjectRef = FUnrealObjectRef(0, 0, FName(*TempPath), OuterObjectRef, true);
 		bNetStartup = Actor->bNetStartup;
 	}
 
@@ -213,7 +162,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 		OutgoingOnCreateEntityRPCs.Remove(Actor);
 	}
 
-	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_Singleton))
+	if (Template.bIsSingleton)
 	{
 		ComponentDatas.Add(Singleton().CreateSingletonData());
 	}
@@ -226,7 +175,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	// If the Actor was loaded rather than dynamically spawned, associate it with its owning sublevel.
 	ComponentDatas.Add(CreateLevelComponentData(Actor));
 
-	if (Actor->IsA<APlayerController>())
+	if (Template.bIsPlayerController)
 	{
 #if !UE_BUILD_SHIPPING
 		ComponentDatas.Add(ComponentFactory::CreateEmptyComponentData(SpatialConstants::DEBUG_METRICS_COMPONENT_ID));
@@ -255,7 +204,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	}
 
 	InterestFactory InterestDataFactory(Actor, Info, NetDriver);
-	ComponentDatas.Add(InterestDataFactory.CreateInterestData());
+	ComponentDatas.Add(InterestDataFactory.CreateInterestData(Channel->SentInterest));
 
 	ComponentDatas.Add(ClientRPCEndpoint().CreateRPCEndpointData());
 	ComponentDatas.Add(ServerRPCEndpoint().CreateRPCEndpointData());
@@ -365,6 +314,12 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 
 	ComponentDatas.Add(EntityAcl(ReadAcl, ComponentWriteAcl).CreateEntityAclData());
 
+	OutBytesWritten = 0;
+	for (const Worker_ComponentData& ComponentData : ComponentDatas)
+	{
+		OutBytesWritten += GetComponentDataSize(ComponentData);
+	}
+
 	Worker_EntityId EntityId = Channel->GetEntityId();
 	Worker_RequestId CreateEntityRequestId = Connection->SendCreateEntityRequest(MoveTemp(ComponentDatas), &EntityId);
 	PendingActorRequests.Add(CreateEntityRequestId, Channel);
@@ -372,6 +327,102 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	return CreateEntityRequestId;
 }
 
+const FEntityCreationTemplate& USpatialSender::GetOrCreateEntityCreationTemplate(UClass* Class, const FClassInfo& Info)
+{
+	if (const FEntityCreationTemplate* ExistingTemplate = EntityCreationTemplates.Find(Class))
+	{
+		return *ExistingTemplate;
+	}
+
+	FEntityCreationTemplate& Template = EntityCreationTemplates.Add(Class);
+	Template.bIsPlayerController = Class->IsChildOf<APlayerController>();
+	Template.bIsSingleton = Class->HasAnySpatialClassFlags(SPATIALCLASS_Singleton);
+
+	WorkerRequirementSet AnyServerRequirementSet;
+	WorkerRequirementSet AnyServerOrClientRequirementSet = { SpatialConstants::UnrealClientAttributeSet };
+
+	for (const FName& WorkerType : GetDefault<USpatialGDKSettings>()->ServerWorkerTypes)
+	{
+		WorkerAttributeSet ServerWorkerAttributeSet = { WorkerType.ToString() };
+
+		AnyServerRequirementSet.Add(ServerWorkerAttributeSet);
+		AnyServerOrClientRequirementSet.Add(ServerWorkerAttributeSet);
+	}
+
+	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly))
+	{
+		Template.ReadAcl = AnyServerRequirementSet;
+	}
+	else if (Template.bIsPlayerController)
+	{
+		// The owning client's attribute set is inserted at the front per entity.
+		Template.ReadAcl = AnyServerRequirementSet;
+	}
+	else
+	{
+		Template.ReadAcl = AnyServerOrClientRequirementSet;
+	}
+
+	const WorkerAttributeSet WorkerAttribute{ Info.WorkerType.ToString() };
+	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { WorkerAttribute };
+
+	// The worker type configured to own the actor group keeps the EntityACL, so it can move the group while load-aware offloading.
+	const WorkerAttributeSet HomeWorkerAttribute{ ActorGroupManager->GetHomeWorkerTypeForActorGroup(Info.ActorGroup).ToString() };
+	const WorkerRequirementSet HomeWorkerRequirementSet = { HomeWorkerAttribute };
+
+	WriteAclMap& ComponentWriteAcl = Template.ComponentWriteAcl;
+	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::SPAWN_DATA_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, HomeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+
+#if !UE_BUILD_SHIPPING
+	if (Template.bIsPlayerController)
+	{
+		ComponentWriteAcl.Add(SpatialConstants::DEBUG_METRICS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	}
+#endif // !UE_BUILD_SHIPPING
+
+	ComponentWriteAcl.Add(SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+
+	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+	{
+		Worker_ComponentId ComponentId = Info.SchemaComponents[Type];
+		if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
+		{
+			return;
+		}
+
+		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
+	});
+
+	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
+	{
+		const FClassInfo& SubobjectInfo = SubobjectInfoPair.Value.Get();
+
+		TArray<Worker_ComponentId> SubobjectComponentIds;
+		ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+		{
+			Worker_ComponentId ComponentId = SubobjectInfo.SchemaComponents[Type];
+			if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
+			{
+				return;
+			}
+
+			SubobjectComponentIds.Add(ComponentId);
+		});
+
+		if (SubobjectComponentIds.Num() > 0)
+		{
+			Template.StaticSubobjectComponentIds.Emplace(SubobjectInfoPair.Key, MoveTemp(SubobjectComponentIds));
+		}
+	}
+
+	return Template;
+}
+
 Worker_ComponentData USpatialSender::CreateLevelComponentData(AActor* Actor)
 {
 	UWorld* ActorWorld = Actor->GetTypedOuter<UWorld>();
@@ -543,7 +594,7 @@ void USpatialSender::CreateServerWorkerEntity(int AttemptCounter)
 	Receiver->AddCreateEntityDelegate(RequestId, OnCreateWorkerEntityResponse);
 }
 
-void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges)
+int64 USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderSendComponentUpdates);
 	Worker_EntityId EntityId = Channel->GetEntityId();
@@ -585,8 +636,12 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 		}
 	}
 
+	int64 BytesWritten = 0;
+
 	for (Worker_ComponentUpdate& Update : ComponentUpdates)
 	{
+		BytesWritten += GetComponentUpdateSize(Update);
+
 		if (!NetDriver->StaticComponentView->HasAuthority(EntityId, Update.component_id))
 		{
 			UE_LOG(LogSpatialSender, Verbose, TEXT("Trying to send component update but don't have authority! Update will be queued and sent when authority gained. Component Id: %d, entity: %lld"), Update.component_id, EntityId);
@@ -601,6 +656,8 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 
 		Connection->SendComponentUpdate(EntityId, &Update);
 	}
+
+	return BytesWritten;
 }
 
 // Apply (and clean up) any updates queued, due to being sent previously when they didn't have authority.
@@ -616,6 +673,56 @@ void USpatialSender::ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId
 	}
 }
 
+void USpatialSender::QueueOwnershipChange(USpatialActorChannel* Channel)
+{
+	ChannelsWithOwnershipChange.Add(Channel);
+}
+
+void USpatialSender::ProcessOwnershipChanges()
+{
+	if (ChannelsWithOwnershipChange.Num() == 0)
+	{
+		return;
+	}
+
+	// Each changed Actor's whole ownership hierarchy needs its EntityACL updated. Hierarchies reached from several
+	// changed Actors (e.g. a Pawn and its attachments all changing owner on possession) are only processed once.
+	TSet<Worker_EntityId_Key> ProcessedEntities;
+	TArray<USpatialActorChannel*> ChannelsToProcess;
+
+	for (const TWeakObjectPtr<USpatialActorChannel>& Channel : ChannelsWithOwnershipChange)
+	{
+		if (Channel.IsValid())
+		{
+			ChannelsToProcess.Add(Channel.Get());
+		}
+	}
+
+	ChannelsWithOwnershipChange.Empty();
+
+	while (ChannelsToProcess.Num() > 0)
+	{
+		USpatialActorChannel* Channel = ChannelsToProcess.Pop(false);
+
+		bool bAlreadyProcessed = false;
+		ProcessedEntities.Add(Channel->GetEntityId(), &bAlreadyProcessed);
+		if (bAlreadyProcessed || Channel->Actor == nullptr || !Channel->ServerProcessOwnershipChange())
+		{
+			continue;
+		}
+
+		for (AActor* Child : Channel->Actor->Children)
+		{
+			Worker_EntityId ChildEntityId = PackageMap->GetEntityIdFromObject(Child);
+
+			if (USpatialActorChannel* ChildChannel = NetDriver->GetActorChannelByEntityId(ChildEntityId))
+			{
+				ChannelsToProcess.Add(ChildChannel);
+			}
+		}
+	}
+}
+
 void USpatialSender::FlushPackedRPCs()
 {
 	if (RPCsToPack.Num() == 0)
@@ -668,11 +775,17 @@ void FillComponentInterests(const FClassInfo& Info, bool bNetOwned, TArray<Worke
 	}
 }
 
-TArray<Worker_InterestOverride> USpatialSender::CreateComponentInterestForActor(USpatialActorChannel* Channel, bool bIsNetOwned)
+const TArray<Worker_InterestOverride>& USpatialSender::GetOrCreateClassComponentInterest(UClass* Class, bool bIsNetOwned)
 {
-	TArray<Worker_InterestOverride> ComponentInterest;
+	const TPair<TWeakObjectPtr<UClass>, bool> Key(Class, bIsNetOwned);
+	if (const TArray<Worker_InterestOverride>* ExistingInterest = ClassComponentInterest.Find(Key))
+	{
+		return *ExistingInterest;
+	}
 
-	const FClassInfo& ActorInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Channel->Actor->GetClass());
+	TArray<Worker_InterestOverride>& ComponentInterest = ClassComponentInterest.Add(Key);
+
+	const FClassInfo& ActorInfo = ClassInfoManager->GetOrCreateClassInfoByClass(Class);
 	FillComponentInterests(ActorInfo, bIsNetOwned, ComponentInterest);
 
 	// Statically attached subobjects
@@ -682,6 +795,16 @@ TArray<Worker_InterestOverride> USpatialSender::CreateComponentInterestForActor(
 		FillComponentInterests(SubobjectInfo, bIsNetOwned, ComponentInterest);
 	}
 
+	ComponentInterest.Add({ SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, bIsNetOwned });
+	ComponentInterest.Add({ SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, bIsNetOwned });
+
+	return ComponentInterest;
+}
+
+TArray<Worker_InterestOverride> USpatialSender::CreateComponentInterestForActor(USpatialActorChannel* Channel, bool bIsNetOwned)
+{
+	TArray<Worker_InterestOverride> ComponentInterest = GetOrCreateClassComponentInterest(Channel->Actor->GetClass(), bIsNetOwned);
+
 	// Subobjects dynamically created through replication
 	for (const auto& Subobject : Channel->CreateSubObjects)
 	{
@@ -689,9 +812,6 @@ TArray<Worker_InterestOverride> USpatialSender::CreateComponentInterestForActor(
 		FillComponentInterests(SubobjectInfo, bIsNetOwned, ComponentInterest);
 	}
 
-	ComponentInterest.Add({ SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, bIsNetOwned });
-	ComponentInterest.Add({ SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, bIsNetOwned });
-
 	return ComponentInterest;
 }
 
@@ -718,7 +838,38 @@ void USpatialSender::SendComponentInterestForActor(USpatialActorChannel* Channel
 {
 	checkf(!NetDriver->IsServer(), TEXT("Tried to set ComponentInterest on a server-worker. This should never happen!"));
 
-	NetDriver->Connection->SendComponentInterest(EntityId, CreateComponentInterestForActor(Channel, bNetOwned));
+	if (!Channel->bComponentInterestDirty)
+	{
+		// Only the overrides which depend on ownership need to be sent again.
+		const TArray<Worker_InterestOverride>& ComponentInterestDelta = Channel->ComponentInterestDelta[bNetOwned ? 1 : 0];
+		if (ComponentInterestDelta.Num() > 0)
+		{
+			NetDriver->Connection->SendComponentInterest(EntityId, TArray<Worker_InterestOverride>(ComponentInterestDelta));
+		}
+		return;
+	}
+
+	TArray<Worker_InterestOverride> ComponentInterest = CreateComponentInterestForActor(Channel, bNetOwned);
+	TArray<Worker_InterestOverride> OtherComponentInterest = CreateComponentInterestForActor(Channel, !bNetOwned);
+	check(ComponentInterest.Num() == OtherComponentInterest.Num());
+
+	TArray<Worker_InterestOverride>& DeltaToNetOwned = Channel->ComponentInterestDelta[1];
+	TArray<Worker_InterestOverride>& DeltaToNotNetOwned = Channel->ComponentInterestDelta[0];
+	DeltaToNetOwned.Reset();
+	DeltaToNotNetOwned.Reset();
+
+	for (int32 i = 0; i < ComponentInterest.Num(); i++)
+	{
+		if (ComponentInterest[i].is_interested != OtherComponentInterest[i].is_interested)
+		{
+			DeltaToNetOwned.Add(bNetOwned ? ComponentInterest[i] : OtherComponentInterest[i]);
+			DeltaToNotNetOwned.Add(bNetOwned ? OtherComponentInterest[i] : ComponentInterest[i]);
+		}
+	}
+
+	Channel->bComponentInterestDirty = false;
+
+	NetDriver->Connection->SendComponentInterest(EntityId, MoveTemp(ComponentInterest));
 }
 
 void USpatialSender::SendComponentInterestForSubobject(const FClassInfo& Info, Worker_EntityId EntityId, bool bNetOwned)
@@ -746,6 +897,9 @@ void USpatialSender::SendPositionUpdate(Worker_EntityId EntityId, const FVector&
 
 bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 {
+	// RPCs to the owning client must be sent after the EntityACL update giving it the client RPC endpoint.
+	ProcessOwnershipChanges();
+
 	TWeakObjectPtr<UObject> TargetObjectWeakPtr = PackageMap->GetObjectFromUnrealObjectRef(Params.ObjectRef);
 	if (!TargetObjectWeakPtr.IsValid())
 	{
@@ -983,12 +1137,15 @@ void USpatialSender::ProcessPositionUpdates()
 	ChannelsToUpdatePosition.Empty();
 }
 
-void USpatialSender::SendCreateEntityRequest(USpatialActorChannel* Channel)
+int64 USpatialSender::SendCreateEntityRequest(USpatialActorChannel* Channel)
 {
 	UE_LOG(LogSpatialSender, Log, TEXT("Sending create entity request for %s with EntityId %lld"), *Channel->Actor->GetName(), Channel->GetEntityId());
 
-	Worker_RequestId RequestId = CreateEntity(Channel);
+	int64 BytesWritten = 0;
+	Worker_RequestId RequestId = CreateEntity(Channel, BytesWritten);
 	Receiver->AddPendingActorRequest(RequestId, Channel);
+
+	return BytesWritten;
 }
 
 void USpatialSender::SendDeleteEntityRequest(Worker_EntityId EntityId)
@@ -1383,20 +1540,97 @@ bool USpatialSender::UpdateEntityACLs(Worker_EntityId EntityId, const FString& O
 	WorkerAttributeSet OwningClientAttribute = { OwnerWorkerAttribute };
 	WorkerRequirementSet OwningClientOnly = { OwningClientAttribute };
 
+	const WorkerRequirementSet* CurrentRequirementSet = EntityACL->ComponentWriteAcl.Find(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID);
+	if (CurrentRequirementSet != nullptr && *CurrentRequirementSet == OwningClientOnly)
+	{
+		// Already up to date, e.g. ownership changed and changed back before it was processed.
+		return true;
+	}
+
 	EntityACL->ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, OwningClientOnly);
-	Worker_ComponentUpdate Update = EntityACL->CreateEntityAclUpdate();
+
+	// The read ACL doesn't depend on the owner, so only the write ACL needs to be sent.
+	Worker_ComponentUpdate Update = EntityACL->CreateComponentWriteAclUpdate();
+
+	Connection->SendComponentUpdate(EntityId, &Update);
+	return true;
+}
+
+// Moves authority over every component but the EntityACL to WorkerType, for the components the Actor's worker type is authoritative over.
+// Components owned by the owning client keep their write ACL.
+bool USpatialSender::UpdateEntityACLWorkerType(Worker_EntityId EntityId, FName WorkerType)
+{
+	EntityAcl* EntityACL = StaticComponentView->GetComponentData<EntityAcl>(EntityId);
+
+	if (EntityACL == nullptr)
+	{
+		return false;
+	}
+
+	if (!NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
+	{
+		UE_LOG(LogSpatialSender, Warning, TEXT("Trying to update EntityACL but don't have authority! Update will not be sent. Entity: %lld"), EntityId);
+		return false;
+	}
+
+	const WorkerAttributeSet WorkerAttribute{ WorkerType.ToString() };
+	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { WorkerAttribute };
+
+	if (!EntityACL->SetWorkerTypeAuthority(AuthoritativeWorkerRequirementSet))
+	{
+		return true;
+	}
+
+	Worker_ComponentUpdate Update = EntityACL->CreateComponentWriteAclUpdate();
 
 	Connection->SendComponentUpdate(EntityId, &Update);
 	return true;
 }
 
+void USpatialSender::UpdateActorGroupWorkerType(FName ActorGroup)
+{
+	// The entity creation templates of the group's classes are built for the worker type it had.
+	for (auto It = EntityCreationTemplates.CreateIterator(); It; ++It)
+	{
+		UClass* Class = It.Key().Get();
+		if (Class == nullptr || ClassInfoManager->GetOrCreateClassInfoByClass(Class).ActorGroup == ActorGroup)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const auto& EntityChannelPair : NetDriver->GetEntityToActorChannelMap())
+	{
+		const Worker_EntityId EntityId = EntityChannelPair.Key;
+		USpatialActorChannel* Channel = EntityChannelPair.Value;
+		if (Channel == nullptr || Channel->Actor == nullptr || !StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
+		{
+			continue;
+		}
+
+		const FClassInfo& Info = ClassInfoManager->GetOrCreateClassInfoByObject(Channel->Actor);
+		if (Info.ActorGroup == ActorGroup)
+		{
+			UpdateEntityACLWorkerType(EntityId, Info.WorkerType);
+		}
+	}
+}
+
 void USpatialSender::UpdateInterestComponent(AActor* Actor)
 {
 	InterestFactory InterestUpdateFactory(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), NetDriver);
-	Worker_ComponentUpdate Update = InterestUpdateFactory.CreateInterestUpdate();
-
 	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
-	Connection->SendComponentUpdate(EntityId, &Update);
+
+	// Skip the update if the Interest is the same as last sent for this entity.
+	USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId);
+	LastSentInterest UnknownSentInterest;
+	LastSentInterest& SentInterest = Channel != nullptr ? Channel->SentInterest : UnknownSentInterest;
+
+	Worker_ComponentUpdate Update;
+	if (InterestUpdateFactory.CreateInterestUpdate(SentInterest, Update))
+	{
+		Connection->SendComponentUpdate(EntityId, &Update);
+	}
 }
 
 void USpatialSender::ProcessRPC(FPendingRPCParamsPtr Params)
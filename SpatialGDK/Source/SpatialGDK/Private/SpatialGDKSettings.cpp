@@ -15,13 +15,22 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, EntityPoolInitialReservationCount(3000)
 	, EntityPoolRefreshThreshold(1000)
 	, EntityPoolRefreshCount(2000)
+	, EntityPoolMaxPendingRequests(4)
 	, HeartbeatIntervalSeconds(2.0f)
 	, HeartbeatTimeoutSeconds(10.0f)
 	, ActorReplicationRateLimit(0)
 	, EntityCreationRateLimit(0)
+	, ActorReplicationByteLimit(0)
+	, ActorReplicationByteLimitPerConnection(0)
 	, OpsUpdateRate(1000.0f)
+	, bEnableAdaptiveReplicationBudget(false)
+	, TargetReplicationTimeMs(8.0f)
+	, MaxQueuedOutgoingMessages(10000)
+	, ReplicationStarvationTime(2.0f)
 	, bEnableHandover(true)
 	, MaxNetCullDistanceSquared(900000000.0f) // Set to twice the default Actor NetCullDistanceSquared (300m)
+	, bUseReplicationGrid(false)
+	, ReplicationGridCellSize(5000.0f) // 50m
 	, QueuedIncomingRPCWaitTime(1.0f)
 	, bUsingQBI(true)
 	, PositionUpdateFrequency(1.0f)
@@ -32,12 +41,22 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bUseFrameTimeAsLoad(false)
 	, bCheckRPCOrder(false)
 	, bBatchSpatialPositionUpdates(true)
+	, bUsePersistentConsiderList(false)
+	, ConsiderListReconcileInterval(1.0f)
+	, bParallelPropertyComparison(false)
+	, ParallelPropertyComparisonMinActors(32)
+	, bEnableClassInfoWarmUp(false)
+	, ClassInfoWarmUpBudgetMs(2.0f)
 	, MaxDynamicallyAttachedSubobjectsPerClass(3)
 	, bEnableServerQBI(bUsingQBI)
 	, bPackRPCs(true)
 	, bUseDevelopmentAuthenticationFlow(false)
 	, DefaultWorkerType(FWorkerType(SpatialConstants::DefaultServerWorkerType))
 	, bEnableOffloading(false)
+	, bEnableLoadAwareOffloading(false)
+	, LoadAwareOffloadingHighLoad(1.0f)
+	, LoadAwareOffloadingLowLoad(0.7f)
+	, LoadAwareOffloadingMinSecondsBetweenReassignments(30.0f)
 	, ServerWorkerTypes({ SpatialConstants::DefaultServerWorkerType })
 {
 	DefaultReceptionistHost = SpatialConstants::LOCAL_HOST;
@@ -0,0 +1,200 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#include "GameFramework/Character.h"
+#include "GameFramework/Pawn.h"
+
+#include "Interop/GlobalStateManager.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/ActorGroupManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace SpatialGDK;
+
+namespace
+{
+const FName DefaultWorkerType(TEXT("UnrealWorker"));
+const FName OffloadWorkerType(TEXT("OffloadWorker"));
+const FName OtherWorkerType(TEXT("OtherWorker"));
+
+// Pawns, and Characters through them, are in a group that can be offloaded. Actors are in a group that can't.
+const FName PawnGroup(TEXT("Pawns"));
+const FName ActorGroup(TEXT("Actors"));
+
+const FString ClientWorkerAttribute(TEXT("workerId:Client0"));
+
+FActorGroupInfo CreateActorGroupInfo(FName Name, FName OwningWorkerType, TSubclassOf<AActor> ActorClass, FName LoadAwareOffloadWorkerType)
+{
+	FActorGroupInfo Info;
+	Info.Name = Name;
+	Info.OwningWorkerType = FWorkerType(OwningWorkerType);
+	Info.ActorClasses.Add(TSoftClassPtr<AActor>(ActorClass.Get()));
+	Info.LoadAwareOffloadWorkerType = FWorkerType(LoadAwareOffloadWorkerType);
+	return Info;
+}
+
+// Stands in for the actor group manager of a server worker, initialized from the same settings on every worker.
+UActorGroupManager* CreateActorGroupManager()
+{
+	USpatialGDKSettings* Settings = NewObject<USpatialGDKSettings>();
+	Settings->DefaultWorkerType = FWorkerType(DefaultWorkerType);
+	Settings->bEnableOffloading = true;
+	Settings->bEnableLoadAwareOffloading = true;
+	Settings->LoadAwareOffloadingHighLoad = 1.0f;
+	Settings->LoadAwareOffloadingLowLoad = 0.5f;
+	Settings->LoadAwareOffloadingMinSecondsBetweenReassignments = 0.0f;
+	Settings->ActorGroups.Add(PawnGroup, CreateActorGroupInfo(PawnGroup, DefaultWorkerType, APawn::StaticClass(), OffloadWorkerType));
+	Settings->ActorGroups.Add(ActorGroup, CreateActorGroupInfo(ActorGroup, OtherWorkerType, AActor::StaticClass(), NAME_None));
+
+	UActorGroupManager* ActorGroupManager = NewObject<UActorGroupManager>();
+	ActorGroupManager->Init(*Settings);
+	return ActorGroupManager;
+}
+
+StringToStringMap CreateOffloadedPawnGroup(const FName WorkerType)
+{
+	StringToStringMap OffloadedActorGroupToWorkerType;
+	OffloadedActorGroupToWorkerType.Add(PawnGroup.ToString(), WorkerType.ToString());
+	return OffloadedActorGroupToWorkerType;
+}
+
+// Sends the assignments through the ActorGroupAssignments component update, like UGlobalStateManager::SetOffloadedActorGroups.
+StringToStringMap SendActorGroupAssignments(const StringToStringMap& OffloadedActorGroupToWorkerType)
+{
+	Worker_ComponentUpdate Update = UGlobalStateManager::CreateActorGroupAssignmentsUpdate(OffloadedActorGroupToWorkerType);
+	StringToStringMap Received = UGlobalStateManager::GetOffloadedActorGroupsFromUpdate(Update);
+	Schema_DestroyComponentUpdate(Update.schema_type);
+	return Received;
+}
+
+// Sends a load report through the report_worker_load command, like UGlobalStateManager::SendWorkerLoadReport.
+void SendWorkerLoadReport(UActorGroupManager* DecidingActorGroupManager, const FString& WorkerId, FName WorkerType, double Load, const TArray<FString>& OwnedActorGroups)
+{
+	Worker_CommandRequest CommandRequest = UGlobalStateManager::CreateWorkerLoadReportRequest(WorkerType, Load, OwnedActorGroups);
+
+	FName ReceivedWorkerType;
+	double ReceivedLoad;
+	TArray<FString> ReceivedOwnedActorGroups;
+	UGlobalStateManager::ReadWorkerLoadReport(Schema_GetCommandRequestObject(CommandRequest.schema_type), ReceivedWorkerType, ReceivedLoad, ReceivedOwnedActorGroups);
+	Schema_DestroyCommandRequest(CommandRequest.schema_type);
+
+	DecidingActorGroupManager->ReportWorkerLoad(WorkerId, ReceivedWorkerType, ReceivedLoad, ReceivedOwnedActorGroups, 0.0);
+}
+
+// Runs the deciding worker's policy and shares its reassignments with another worker, like USpatialNetDriver::UpdateLoadAwareOffloading.
+void DecideAndShareReassignments(UActorGroupManager* DecidingActorGroupManager, UActorGroupManager* OtherActorGroupManager, StringToStringMap& InOutOffloadedActorGroupToWorkerType)
+{
+	DecidingActorGroupManager->AddReassignmentsToOffloadedActorGroups(DecidingActorGroupManager->UpdateLoadAwareOffloading(0.0), InOutOffloadedActorGroupToWorkerType);
+
+	const StringToStringMap Received = SendActorGroupAssignments(InOutOffloadedActorGroupToWorkerType);
+	DecidingActorGroupManager->ApplyActorGroupAssignments(Received);
+	OtherActorGroupManager->ApplyActorGroupAssignments(Received);
+}
+
+WorkerRequirementSet CreateRequirementSet(const FString& Attribute)
+{
+	const WorkerAttributeSet AttributeSet{ Attribute };
+	return WorkerRequirementSet{ AttributeSet };
+}
+
+// An Actor's EntityACL as created by its home worker type, with its client RPCs owned by a client.
+EntityAcl CreateEntityAcl()
+{
+	const WorkerRequirementSet HomeWorkerType = CreateRequirementSet(DefaultWorkerType.ToString());
+
+	WriteAclMap ComponentWriteAcl;
+	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, HomeWorkerType);
+	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, HomeWorkerType);
+	ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID, HomeWorkerType);
+	ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID, CreateRequirementSet(ClientWorkerAttribute));
+	return EntityAcl(WorkerRequirementSet{}, ComponentWriteAcl);
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorGroupReassignmentApplyAssignmentsTest, "SpatialGDK.ActorGroupReassignment.ApplyAssignments", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FActorGroupReassignmentApplyAssignmentsTest::RunTest(const FString& Parameters)
+{
+	UActorGroupManager* ActorGroupManager = CreateActorGroupManager();
+
+	// Resolve the classes first, so the cached assignments have to be updated too.
+	TestEqual(TEXT("Class starts on its group's owning worker type"), ActorGroupManager->GetWorkerTypeForClass(APawn::StaticClass()), DefaultWorkerType);
+	TestEqual(TEXT("Derived class starts on its group's owning worker type"), ActorGroupManager->GetWorkerTypeForClass(ACharacter::StaticClass()), DefaultWorkerType);
+
+	const TArray<FName> Reassigned = ActorGroupManager->ApplyActorGroupAssignments(CreateOffloadedPawnGroup(OffloadWorkerType));
+	TestEqual(TEXT("Only the offloaded group is reassigned"), Reassigned.Num(), 1);
+	TestTrue(TEXT("Offloaded group is reported as reassigned"), Reassigned.Contains(PawnGroup));
+	TestEqual(TEXT("Offloaded group moves to the offload worker type"), ActorGroupManager->GetWorkerTypeForActorGroup(PawnGroup), OffloadWorkerType);
+	TestEqual(TEXT("Cached class assignment moves with its group"), ActorGroupManager->GetWorkerTypeForClass(APawn::StaticClass()), OffloadWorkerType);
+	TestEqual(TEXT("Cached derived class assignment moves with its group"), ActorGroupManager->GetWorkerTypeForClass(ACharacter::StaticClass()), OffloadWorkerType);
+	TestEqual(TEXT("Offloaded group keeps its home worker type"), ActorGroupManager->GetHomeWorkerTypeForActorGroup(PawnGroup), DefaultWorkerType);
+	TestEqual(TEXT("Other group stays on its worker type"), ActorGroupManager->GetWorkerTypeForActorGroup(ActorGroup), OtherWorkerType);
+
+	TestEqual(TEXT("Applying the same assignments again reassigns nothing"), ActorGroupManager->ApplyActorGroupAssignments(CreateOffloadedPawnGroup(OffloadWorkerType)).Num(), 0);
+
+	AddExpectedError(TEXT("unknown worker type"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestEqual(TEXT("Group offloaded to an unknown worker type isn't reassigned"), ActorGroupManager->ApplyActorGroupAssignments(CreateOffloadedPawnGroup(TEXT("UnknownWorker"))).Num(), 0);
+	TestEqual(TEXT("Group offloaded to an unknown worker type keeps its worker type"), ActorGroupManager->GetWorkerTypeForActorGroup(PawnGroup), OffloadWorkerType);
+
+	TestEqual(TEXT("Group missing from the assignments is reassigned"), ActorGroupManager->ApplyActorGroupAssignments(StringToStringMap()).Num(), 1);
+	TestEqual(TEXT("Group missing from the assignments goes back home"), ActorGroupManager->GetWorkerTypeForClass(ACharacter::StaticClass()), DefaultWorkerType);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorGroupReassignmentEntityAclWorkerTypeTest, "SpatialGDK.ActorGroupReassignment.EntityAclWorkerType", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FActorGroupReassignmentEntityAclWorkerTypeTest::RunTest(const FString& Parameters)
+{
+	EntityAcl Acl = CreateEntityAcl();
+	const WorkerRequirementSet HomeWorkerType = CreateRequirementSet(DefaultWorkerType.ToString());
+	const WorkerRequirementSet OffloadWorkerTypeSet = CreateRequirementSet(OffloadWorkerType.ToString());
+
+	TestFalse(TEXT("Moving to the current worker type changes nothing"), Acl.SetWorkerTypeAuthority(HomeWorkerType));
+
+	TestTrue(TEXT("Moving to another worker type changes the ACL"), Acl.SetWorkerTypeAuthority(OffloadWorkerTypeSet));
+	TestTrue(TEXT("Position moves"), Acl.ComponentWriteAcl[SpatialConstants::POSITION_COMPONENT_ID] == OffloadWorkerTypeSet);
+	TestTrue(TEXT("Server RPCs move"), Acl.ComponentWriteAcl[SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID] == OffloadWorkerTypeSet);
+	TestTrue(TEXT("EntityACL stays with the home worker type"), Acl.ComponentWriteAcl[SpatialConstants::ENTITY_ACL_COMPONENT_ID] == HomeWorkerType);
+	TestTrue(TEXT("Client RPCs stay with the owning client"), Acl.ComponentWriteAcl[SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID] == CreateRequirementSet(ClientWorkerAttribute));
+
+	TestTrue(TEXT("Moving back changes the ACL"), Acl.SetWorkerTypeAuthority(HomeWorkerType));
+	TestTrue(TEXT("Position moves back"), Acl.ComponentWriteAcl[SpatialConstants::POSITION_COMPONENT_ID] == HomeWorkerType);
+	TestTrue(TEXT("Client RPCs still stay with the owning client"), Acl.ComponentWriteAcl[SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID] == CreateRequirementSet(ClientWorkerAttribute));
+
+	EntityAcl NoPositionAcl;
+	TestFalse(TEXT("ACL without Position isn't changed"), NoPositionAcl.SetWorkerTypeAuthority(OffloadWorkerTypeSet));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorGroupReassignmentGlobalStateManagerRoundTripTest, "SpatialGDK.ActorGroupReassignment.GlobalStateManagerRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FActorGroupReassignmentGlobalStateManagerRoundTripTest::RunTest(const FString& Parameters)
+{
+	const StringToStringMap Offloaded = CreateOffloadedPawnGroup(OffloadWorkerType);
+	TestTrue(TEXT("Offloaded groups survive the component update"), SendActorGroupAssignments(Offloaded).OrderIndependentCompareEqual(Offloaded));
+	TestEqual(TEXT("No offloaded groups are sent as a cleared field"), SendActorGroupAssignments(StringToStringMap()).Num(), 0);
+
+	// The worker authoritative over the GSM decides for a second worker of the same type, from the loads of both.
+	UActorGroupManager* DecidingActorGroupManager = CreateActorGroupManager();
+	UActorGroupManager* OtherActorGroupManager = CreateActorGroupManager();
+	StringToStringMap OffloadedActorGroupToWorkerType;
+
+	SendWorkerLoadReport(DecidingActorGroupManager, TEXT("UnrealWorker0"), DefaultWorkerType, 0.9, {});
+	SendWorkerLoadReport(DecidingActorGroupManager, TEXT("UnrealWorker1"), DefaultWorkerType, 1.5, {});
+	DecideAndShareReassignments(DecidingActorGroupManager, OtherActorGroupManager, OffloadedActorGroupToWorkerType);
+	TestEqual(TEXT("Group is offloaded when the average load of its worker type is high"), OtherActorGroupManager->GetWorkerTypeForActorGroup(PawnGroup), OffloadWorkerType);
+	TestEqual(TEXT("Deciding worker applies the assignments too"), DecidingActorGroupManager->GetWorkerTypeForActorGroup(PawnGroup), OffloadWorkerType);
+
+	// The offload worker now has a player's Pawn, whose owner only the home worker type can change.
+	SendWorkerLoadReport(DecidingActorGroupManager, TEXT("OffloadWorker0"), OffloadWorkerType, 0.1, { PawnGroup.ToString() });
+	DecideAndShareReassignments(DecidingActorGroupManager, OtherActorGroupManager, OffloadedActorGroupToWorkerType);
+	TestEqual(TEXT("Group with an owned Actor is taken back while its home worker type is still loaded"), OtherActorGroupManager->GetWorkerTypeForActorGroup(PawnGroup), DefaultWorkerType);
+	TestEqual(TEXT("Group taken back is removed from the offloaded groups"), OffloadedActorGroupToWorkerType.Num(), 0);
+
+	DecideAndShareReassignments(DecidingActorGroupManager, OtherActorGroupManager, OffloadedActorGroupToWorkerType);
+	TestEqual(TEXT("Group with an owned Actor isn't offloaded again"), OtherActorGroupManager->GetWorkerTypeForActorGroup(PawnGroup), DefaultWorkerType);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,153 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/InterestEvaluator.h"
+#include "Utils/InterestFactory.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_EntityId PlayerEntityId = 1;
+const Worker_EntityId ActorEntityId = 2;
+
+// The components of the Actor's class, of a derived class and of an unrelated class.
+const Worker_ComponentId ActorDataComponentId = 1000;
+const Worker_ComponentId ActorOwnerOnlyComponentId = 1001;
+const Worker_ComponentId DerivedDataComponentId = 1002;
+const Worker_ComponentId OtherDataComponentId = 1003;
+
+// Radii in centimeters, like in the settings.
+const float NearBandRadius = 1000.0f;
+const float FarBandRadius = 10000.0f;
+
+EvaluatedEntity CreateActorEntity(const Coordinates& Position, Worker_ComponentId DataComponentId)
+{
+	EvaluatedEntity Entity;
+	Entity.Position = Position;
+	for (Worker_ComponentId ComponentId : { SpatialConstants::POSITION_COMPONENT_ID, SpatialConstants::SPAWN_DATA_COMPONENT_ID,
+		SpatialConstants::UNREAL_METADATA_COMPONENT_ID, DataComponentId, ActorOwnerOnlyComponentId })
+	{
+		Entity.Components.Add(ComponentId, EvaluatedComponent{ 10.0f, 30.0f });
+	}
+	return Entity;
+}
+
+// The player is at the origin.
+InterestEvaluator CreateEvaluator(const Coordinates& ActorPosition, Worker_ComponentId DataComponentId = ActorDataComponentId)
+{
+	InterestEvaluator Evaluator;
+	Evaluator.AddEntity(PlayerEntityId, CreateActorEntity(Origin, OtherDataComponentId));
+	Evaluator.AddEntity(ActorEntityId, CreateActorEntity(ActorPosition, DataComponentId));
+	return Evaluator;
+}
+
+FClientInterestBand CreateBand(float Radius, bool bFullSnapshot, float MaxFrequency = 0.0f)
+{
+	FClientInterestBand Band;
+	Band.Radius = Radius;
+	Band.bFullSnapshot = bFullSnapshot;
+	Band.MaxFrequency = MaxFrequency;
+	return Band;
+}
+
+// A full snapshot band near the player, and a band further out only receiving the Actor's owner only component at 1Hz.
+TArray<Query> CreateBandQueries(const QueryConstraint& ActorTypeConstraint = QueryConstraint{})
+{
+	FClientInterestBand FarBand = CreateBand(FarBandRadius, false, 1.0f);
+	FarBand.ResultComponentIds.Add(ActorOwnerOnlyComponentId);
+
+	return {
+		InterestFactory::CreateClientInterestBandQuery(CreateBand(NearBandRadius, true), ActorTypeConstraint, QueryConstraint{}),
+		InterestFactory::CreateClientInterestBandQuery(FarBand, ActorTypeConstraint, QueryConstraint{})
+	};
+}
+
+// Stands in for the constraint AddTypeHierarchyToConstraint builds for a class with a derived class.
+QueryConstraint CreateActorTypeConstraint()
+{
+	QueryConstraint ActorTypeConstraint;
+	for (Worker_ComponentId ComponentId : { ActorDataComponentId, DerivedDataComponentId })
+	{
+		QueryConstraint ComponentTypeConstraint;
+		ComponentTypeConstraint.ComponentConstraint = ComponentId;
+		ActorTypeConstraint.OrConstraint.Add(ComponentTypeConstraint);
+	}
+	return ActorTypeConstraint;
+}
+
+TSet<Worker_ComponentId> GetActorComponents(const InterestEvaluationResult& Result)
+{
+	return Result.EntityComponents.FindRef(ActorEntityId);
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClientInterestBandsFullAndPartialBandsTest, "SpatialGDK.ClientInterestBands.FullAndPartialBands", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FClientInterestBandsFullAndPartialBandsTest::RunTest(const FString& Parameters)
+{
+	const TArray<Query> Queries = CreateBandQueries();
+
+	const InterestEvaluationResult NearResult = CreateEvaluator(Coordinates{ 5, 0, 0 }).Evaluate(PlayerEntityId, Queries);
+	TestEqual(TEXT("Actor in the full snapshot band gets every component"), GetActorComponents(NearResult).Num(), 5);
+	TestEqual(TEXT("Components in both bands are received at the higher frequency"),
+		NearResult.ComponentUpdatesPerSecond.FindRef(MakeTuple(static_cast<Worker_EntityId_Key>(ActorEntityId), ActorOwnerOnlyComponentId)), 30.0f);
+
+	const InterestEvaluationResult FarResult = CreateEvaluator(Coordinates{ 50, 0, 0 }).Evaluate(PlayerEntityId, Queries);
+	const TSet<Worker_ComponentId> FarComponents = GetActorComponents(FarResult);
+	TestTrue(TEXT("Actor in the partial band keeps its position"), FarComponents.Contains(SpatialConstants::POSITION_COMPONENT_ID));
+	TestTrue(TEXT("Actor in the partial band keeps the components needed to spawn it"),
+		FarComponents.Contains(SpatialConstants::SPAWN_DATA_COMPONENT_ID) && FarComponents.Contains(SpatialConstants::UNREAL_METADATA_COMPONENT_ID));
+	TestTrue(TEXT("Actor in the partial band gets the band's result components"), FarComponents.Contains(ActorOwnerOnlyComponentId));
+	TestFalse(TEXT("Actor in the partial band doesn't get its other data components"), FarComponents.Contains(ActorDataComponentId));
+	TestEqual(TEXT("Partial band is received at its frequency"),
+		FarResult.ComponentUpdatesPerSecond.FindRef(MakeTuple(static_cast<Worker_EntityId_Key>(ActorEntityId), ActorOwnerOnlyComponentId)), 1.0f);
+
+	const InterestEvaluationResult OutsideResult = CreateEvaluator(Coordinates{ 500, 0, 0 }).Evaluate(PlayerEntityId, Queries);
+	TestFalse(TEXT("Actor beyond every band isn't checked out"), OutsideResult.EntityComponents.Contains(ActorEntityId));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClientInterestBandsDowngradeTest, "SpatialGDK.ClientInterestBands.Downgrade", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FClientInterestBandsDowngradeTest::RunTest(const FString& Parameters)
+{
+	const TArray<Query> Queries = CreateBandQueries();
+
+	// Moving from the full snapshot band into the partial band keeps the entity checked out, but removes the data components the
+	// partial band doesn't receive. These are the components USpatialReceiver::ProcessRemoveComponent marks as stale on the channel.
+	const TSet<Worker_ComponentId> Before = GetActorComponents(CreateEvaluator(Coordinates{ 5, 0, 0 }).Evaluate(PlayerEntityId, Queries));
+	const TSet<Worker_ComponentId> After = GetActorComponents(CreateEvaluator(Coordinates{ 50, 0, 0 }).Evaluate(PlayerEntityId, Queries));
+	const TSet<Worker_ComponentId> Removed = Before.Difference(After);
+
+	TestTrue(TEXT("Entity stays checked out"), After.Contains(SpatialConstants::POSITION_COMPONENT_ID));
+	TestEqual(TEXT("Only the data component is removed"), Removed.Num(), 1);
+	TestTrue(TEXT("Removed component is the Actor's data component"), Removed.Contains(ActorDataComponentId));
+
+	const TSet<Worker_ComponentId> Upgraded = GetActorComponents(CreateEvaluator(Coordinates{ 5, 0, 0 }).Evaluate(PlayerEntityId, Queries));
+	TestTrue(TEXT("Data component is added back when moving back into the full snapshot band"), Upgraded.Contains(ActorDataComponentId));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClientInterestBandsActorClassTest, "SpatialGDK.ClientInterestBands.ActorClass", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FClientInterestBandsActorClassTest::RunTest(const FString& Parameters)
+{
+	const TArray<Query> Queries = CreateBandQueries(CreateActorTypeConstraint());
+	const Coordinates NearPosition{ 5, 0, 0 };
+
+	TestEqual(TEXT("Band for a class applies to Actors of that class"),
+		GetActorComponents(CreateEvaluator(NearPosition).Evaluate(PlayerEntityId, Queries)).Num(), 5);
+	TestEqual(TEXT("Band for a class applies to Actors of its derived classes"),
+		GetActorComponents(CreateEvaluator(NearPosition, DerivedDataComponentId).Evaluate(PlayerEntityId, Queries)).Num(), 5);
+	TestFalse(TEXT("Band for a class doesn't apply to Actors of other classes"),
+		CreateEvaluator(NearPosition, OtherDataComponentId).Evaluate(PlayerEntityId, Queries).EntityComponents.Contains(ActorEntityId));
+
+	TestFalse(TEXT("Band for a class still has its radius"),
+		CreateEvaluator(Coordinates{ 500, 0, 0 }).Evaluate(PlayerEntityId, Queries).EntityComponents.Contains(ActorEntityId));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,108 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#include "GameFramework/Character.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/SpectatorPawn.h"
+
+#include "Utils/ClientInterestDistances.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace SpatialGDK;
+
+namespace
+{
+// ASpectatorPawn derives from ADefaultPawn, which derives from APawn. ACharacter derives from APawn too.
+TMap<UClass*, float> CreateDiscoveredDistances()
+{
+	TMap<UClass*, float> Distances;
+	// Derived classes are added first, so the result doesn't depend on parent classes being gathered before their children.
+	Distances.Add(ASpectatorPawn::StaticClass(), 80.0f);
+	Distances.Add(ADefaultPawn::StaticClass(), 50.0f);
+	Distances.Add(APawn::StaticClass(), 100.0f);
+	Distances.Add(ACharacter::StaticClass(), 200.0f);
+	return Distances;
+}
+
+int32 CountClassConstraints(ClientInterestDistances& Distances, int32& OutNumBuilt)
+{
+	return Distances.GetClassConstraints([&OutNumBuilt](UClass* Class, float DistanceSquared, QueryConstraint& OutConstraint)
+	{
+		OutNumBuilt++;
+		OutConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ FMath::Sqrt(DistanceSquared) };
+		return true;
+	}).Num();
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClientInterestDistancesPrunesCoveredClassesTest, "SpatialGDK.ClientInterestDistances.PrunesCoveredClasses", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FClientInterestDistancesPrunesCoveredClassesTest::RunTest(const FString& Parameters)
+{
+	ClientInterestDistances Distances;
+	Distances.Gather(CreateDiscoveredDistances());
+
+	const TMap<UClass*, float>& DistancesSquared = Distances.GetDistancesSquared();
+	TestEqual(TEXT("Number of classes kept"), DistancesSquared.Num(), 2);
+	TestTrue(TEXT("Parent class is kept"), DistancesSquared.Contains(APawn::StaticClass()));
+	TestTrue(TEXT("Class with a larger distance than its parent is kept"), DistancesSquared.Contains(ACharacter::StaticClass()));
+	TestFalse(TEXT("Class with a smaller distance than its parent is pruned"), DistancesSquared.Contains(ADefaultPawn::StaticClass()));
+	TestFalse(TEXT("Class covered by a parent further up, through a pruned parent, is pruned"), DistancesSquared.Contains(ASpectatorPawn::StaticClass()));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClientInterestDistancesAddsLoadedClassesTest, "SpatialGDK.ClientInterestDistances.AddsLoadedClasses", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FClientInterestDistancesAddsLoadedClassesTest::RunTest(const FString& Parameters)
+{
+	ClientInterestDistances Distances;
+
+	Distances.AddClass(APawn::StaticClass(), 100.0f);
+	TestFalse(TEXT("Classes aren't added before the table is gathered"), Distances.IsGathered());
+	TestEqual(TEXT("Nothing is added before the table is gathered"), Distances.GetDistancesSquared().Num(), 0);
+
+	TMap<UClass*, float> Discovered;
+	Discovered.Add(APawn::StaticClass(), 100.0f);
+	Distances.Gather(Discovered);
+
+	Distances.AddClass(ADefaultPawn::StaticClass(), 50.0f);
+	TestFalse(TEXT("Loaded class covered by its parent is pruned"), Distances.GetDistancesSquared().Contains(ADefaultPawn::StaticClass()));
+
+	Distances.AddClass(ASpectatorPawn::StaticClass(), 80.0f);
+	TestFalse(TEXT("Loaded class covered transitively is pruned"), Distances.GetDistancesSquared().Contains(ASpectatorPawn::StaticClass()));
+
+	Distances.AddClass(ACharacter::StaticClass(), 200.0f);
+	TestTrue(TEXT("Loaded class with a larger distance is kept"), Distances.GetDistancesSquared().Contains(ACharacter::StaticClass()));
+
+	Distances.AddClass(ACharacter::StaticClass(), 300.0f);
+	TestEqual(TEXT("Classes already considered are skipped"), Distances.GetDistancesSquared().FindRef(ACharacter::StaticClass()), 200.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClientInterestDistancesRebuildsClassConstraintsTest, "SpatialGDK.ClientInterestDistances.RebuildsClassConstraints", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FClientInterestDistancesRebuildsClassConstraintsTest::RunTest(const FString& Parameters)
+{
+	ClientInterestDistances Distances;
+	TMap<UClass*, float> Discovered;
+	Discovered.Add(APawn::StaticClass(), 100.0f);
+	Distances.Gather(Discovered);
+
+	int32 NumBuilt = 0;
+	TestEqual(TEXT("A constraint per class kept"), CountClassConstraints(Distances, NumBuilt), 1);
+	TestEqual(TEXT("Constraints are built on first use"), NumBuilt, 1);
+
+	CountClassConstraints(Distances, NumBuilt);
+	TestEqual(TEXT("Constraints are shared until the table changes"), NumBuilt, 1);
+
+	Distances.AddClass(ADefaultPawn::StaticClass(), 50.0f);
+	CountClassConstraints(Distances, NumBuilt);
+	TestEqual(TEXT("Pruned classes don't change the table"), NumBuilt, 1);
+
+	Distances.AddClass(ACharacter::StaticClass(), 200.0f);
+	TestEqual(TEXT("Constraints are rebuilt after the table changes"), CountClassConstraints(Distances, NumBuilt), 2);
+	TestEqual(TEXT("Every class is built again"), NumBuilt, 3);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
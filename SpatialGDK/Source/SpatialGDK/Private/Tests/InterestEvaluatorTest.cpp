@@ -0,0 +1,247 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#include "Utils/InterestEvaluator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_EntityId ViewerEntityId = 1;
+const Worker_EntityId NearEntityId = 2;
+const Worker_EntityId AboveEntityId = 3;
+const Worker_EntityId FarEntityId = 4;
+
+const Worker_ComponentId FirstComponentId = 1000;
+const Worker_ComponentId SecondComponentId = 1001;
+const Worker_ComponentId ViewerComponentId = 1002;
+
+const float BytesPerUpdate = 10.0f;
+const float UpdatesPerSecond = 30.0f;
+
+EvaluatedEntity CreateEntity(const Coordinates& Position, const TArray<Worker_ComponentId>& ComponentIds)
+{
+	EvaluatedEntity Entity;
+	Entity.Position = Position;
+	for (Worker_ComponentId ComponentId : ComponentIds)
+	{
+		Entity.Components.Add(ComponentId, EvaluatedComponent{ BytesPerUpdate, UpdatesPerSecond });
+	}
+	return Entity;
+}
+
+// The viewer is at (10, 0, 10). Near is 5m away from it, Above is right above it and Far is far away from both.
+InterestEvaluator CreateEvaluator()
+{
+	InterestEvaluator Evaluator;
+	Evaluator.AddEntity(ViewerEntityId, CreateEntity(Coordinates{ 10, 0, 10 }, { ViewerComponentId }));
+	Evaluator.AddEntity(NearEntityId, CreateEntity(Coordinates{ 13, 0, 14 }, { FirstComponentId, SecondComponentId }));
+	Evaluator.AddEntity(AboveEntityId, CreateEntity(Coordinates{ 10, 100, 10 }, { FirstComponentId }));
+	Evaluator.AddEntity(FarEntityId, CreateEntity(Coordinates{ 500, 0, 500 }, { SecondComponentId }));
+	return Evaluator;
+}
+
+Query CreateFullSnapshotQuery(const QueryConstraint& Constraint)
+{
+	Query NewQuery;
+	NewQuery.Constraint = Constraint;
+	NewQuery.FullSnapshotResult = true;
+	return NewQuery;
+}
+
+Query CreateComponentQuery(const QueryConstraint& Constraint, Worker_ComponentId ResultComponentId, const TSchemaOption<float>& Frequency)
+{
+	Query NewQuery;
+	NewQuery.Constraint = Constraint;
+	NewQuery.ResultComponentId.Add(ResultComponentId);
+	NewQuery.Frequency = Frequency;
+	return NewQuery;
+}
+
+QueryConstraint CreateComponentConstraint(Worker_ComponentId ComponentId)
+{
+	QueryConstraint Constraint;
+	Constraint.ComponentConstraint = ComponentId;
+	return Constraint;
+}
+
+QueryConstraint CreateEntityIdConstraint(Worker_EntityId EntityId)
+{
+	QueryConstraint Constraint;
+	Constraint.EntityIdConstraint = EntityId;
+	return Constraint;
+}
+
+bool Matches(const InterestEvaluator& Evaluator, const QueryConstraint& Constraint, Worker_EntityId EntityId)
+{
+	return Evaluator.Matches(Constraint, EntityId, Coordinates{ 10, 0, 10 });
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterestEvaluatorAbsoluteConstraintsTest, "SpatialGDK.InterestEvaluator.AbsoluteConstraints", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FInterestEvaluatorAbsoluteConstraintsTest::RunTest(const FString& Parameters)
+{
+	const InterestEvaluator Evaluator = CreateEvaluator();
+
+	QueryConstraint Sphere;
+	Sphere.SphereConstraint = SphereConstraint{ Coordinates{ 10, 0, 10 }, 5.0 };
+	TestTrue(TEXT("Sphere matches an entity on its surface"), Matches(Evaluator, Sphere, NearEntityId));
+	TestFalse(TEXT("Sphere doesn't match an entity above it"), Matches(Evaluator, Sphere, AboveEntityId));
+	TestFalse(TEXT("Sphere doesn't match a far entity"), Matches(Evaluator, Sphere, FarEntityId));
+
+	QueryConstraint Cylinder;
+	Cylinder.CylinderConstraint = CylinderConstraint{ Coordinates{ 10, 0, 10 }, 5.0 };
+	TestTrue(TEXT("Cylinder matches an entity on its surface"), Matches(Evaluator, Cylinder, NearEntityId));
+	TestTrue(TEXT("Cylinder is infinite along the Y axis"), Matches(Evaluator, Cylinder, AboveEntityId));
+	TestFalse(TEXT("Cylinder doesn't match a far entity"), Matches(Evaluator, Cylinder, FarEntityId));
+
+	QueryConstraint Box;
+	Box.BoxConstraint = BoxConstraint{ Coordinates{ 10, 0, 10 }, EdgeLength{ 6, 6, 8 } };
+	TestTrue(TEXT("Box matches an entity on its edge"), Matches(Evaluator, Box, NearEntityId));
+	TestFalse(TEXT("Box doesn't match an entity above it"), Matches(Evaluator, Box, AboveEntityId));
+
+	Box.BoxConstraint = BoxConstraint{ Coordinates{ 10, 0, 10 }, EdgeLength{ 6, 6, 7 } };
+	TestFalse(TEXT("Box edges are centered on its center"), Matches(Evaluator, Box, NearEntityId));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterestEvaluatorRelativeConstraintsTest, "SpatialGDK.InterestEvaluator.RelativeConstraints", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FInterestEvaluatorRelativeConstraintsTest::RunTest(const FString& Parameters)
+{
+	const InterestEvaluator Evaluator = CreateEvaluator();
+
+	QueryConstraint RelativeSphere;
+	RelativeSphere.RelativeSphereConstraint = RelativeSphereConstraint{ 5.0 };
+	TestTrue(TEXT("Relative sphere matches an entity near the viewer"), Matches(Evaluator, RelativeSphere, NearEntityId));
+	TestFalse(TEXT("Relative sphere doesn't match an entity above the viewer"), Matches(Evaluator, RelativeSphere, AboveEntityId));
+	TestFalse(TEXT("Relative sphere is centered on the viewer"), Evaluator.Matches(RelativeSphere, NearEntityId, Origin));
+
+	QueryConstraint RelativeCylinder;
+	RelativeCylinder.RelativeCylinderConstraint = RelativeCylinderConstraint{ 5.0 };
+	TestTrue(TEXT("Relative cylinder matches an entity near the viewer"), Matches(Evaluator, RelativeCylinder, NearEntityId));
+	TestTrue(TEXT("Relative cylinder is infinite along the Y axis"), Matches(Evaluator, RelativeCylinder, AboveEntityId));
+	TestFalse(TEXT("Relative cylinder doesn't match a far entity"), Matches(Evaluator, RelativeCylinder, FarEntityId));
+
+	QueryConstraint RelativeBox;
+	RelativeBox.RelativeBoxConstraint = RelativeBoxConstraint{ EdgeLength{ 6, 6, 8 } };
+	TestTrue(TEXT("Relative box matches an entity near the viewer"), Matches(Evaluator, RelativeBox, NearEntityId));
+	TestFalse(TEXT("Relative box doesn't match an entity above the viewer"), Matches(Evaluator, RelativeBox, AboveEntityId));
+
+	// Relative constraints in queries are centered on the entity the queries are evaluated for.
+	const InterestEvaluationResult Result = Evaluator.Evaluate(ViewerEntityId, { CreateFullSnapshotQuery(RelativeSphere) });
+	TestTrue(TEXT("Viewer checks out the near entity"), Result.EntityComponents.Contains(NearEntityId));
+	TestTrue(TEXT("Viewer checks out itself"), Result.EntityComponents.Contains(ViewerEntityId));
+	TestEqual(TEXT("Viewer checks out nothing else"), Result.EntityComponents.Num(), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterestEvaluatorEntityAndComponentConstraintsTest, "SpatialGDK.InterestEvaluator.EntityAndComponentConstraints", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FInterestEvaluatorEntityAndComponentConstraintsTest::RunTest(const FString& Parameters)
+{
+	const InterestEvaluator Evaluator = CreateEvaluator();
+
+	TestTrue(TEXT("Entity ID constraint matches its entity"), Matches(Evaluator, CreateEntityIdConstraint(FarEntityId), FarEntityId));
+	TestFalse(TEXT("Entity ID constraint doesn't match other entities"), Matches(Evaluator, CreateEntityIdConstraint(FarEntityId), NearEntityId));
+
+	TestTrue(TEXT("Component constraint matches entities with the component"), Matches(Evaluator, CreateComponentConstraint(SecondComponentId), FarEntityId));
+	TestFalse(TEXT("Component constraint doesn't match entities without the component"), Matches(Evaluator, CreateComponentConstraint(SecondComponentId), AboveEntityId));
+
+	TestFalse(TEXT("Nothing matches an empty constraint"), Matches(Evaluator, QueryConstraint(), NearEntityId));
+	TestFalse(TEXT("Entities not in the evaluator don't match"), Matches(Evaluator, CreateEntityIdConstraint(5), 5));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterestEvaluatorAndOrConstraintsTest, "SpatialGDK.InterestEvaluator.AndOrConstraints", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FInterestEvaluatorAndOrConstraintsTest::RunTest(const FString& Parameters)
+{
+	const InterestEvaluator Evaluator = CreateEvaluator();
+
+	QueryConstraint RelativeSphere;
+	RelativeSphere.RelativeSphereConstraint = RelativeSphereConstraint{ 5.0 };
+
+	QueryConstraint And;
+	And.AndConstraint.Add(RelativeSphere);
+	And.AndConstraint.Add(CreateComponentConstraint(SecondComponentId));
+	TestTrue(TEXT("And matches an entity matching every constraint"), Matches(Evaluator, And, NearEntityId));
+	TestFalse(TEXT("And doesn't match an entity only matching some constraints"), Matches(Evaluator, And, FarEntityId));
+
+	QueryConstraint Or;
+	Or.OrConstraint.Add(RelativeSphere);
+	Or.OrConstraint.Add(CreateEntityIdConstraint(FarEntityId));
+	TestTrue(TEXT("Or matches an entity matching the first constraint"), Matches(Evaluator, Or, NearEntityId));
+	TestTrue(TEXT("Or matches an entity matching the second constraint"), Matches(Evaluator, Or, FarEntityId));
+	TestFalse(TEXT("Or doesn't match an entity matching no constraint"), Matches(Evaluator, Or, AboveEntityId));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterestEvaluatorResultComponentsTest, "SpatialGDK.InterestEvaluator.ResultComponents", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FInterestEvaluatorResultComponentsTest::RunTest(const FString& Parameters)
+{
+	const InterestEvaluator Evaluator = CreateEvaluator();
+
+	const InterestEvaluationResult FullSnapshotResult = Evaluator.Evaluate(ViewerEntityId, { CreateFullSnapshotQuery(CreateEntityIdConstraint(NearEntityId)) });
+	TestEqual(TEXT("Full snapshot checks out every component"), FullSnapshotResult.GetNumComponents(), 2);
+	TestEqual(TEXT("Full snapshot estimate"), FullSnapshotResult.EstimatedBytesPerSecond, 2.0 * BytesPerUpdate * UpdatesPerSecond);
+
+	const InterestEvaluationResult ComponentResult = Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(CreateEntityIdConstraint(NearEntityId), SecondComponentId, TSchemaOption<float>()) });
+	TestEqual(TEXT("Result components only check out those components"), ComponentResult.GetNumComponents(), 1);
+	TestTrue(TEXT("Result component is checked out"), ComponentResult.EntityComponents.FindRef(NearEntityId).Contains(SecondComponentId));
+	TestEqual(TEXT("Result component estimate"), ComponentResult.EstimatedBytesPerSecond, static_cast<double>(BytesPerUpdate * UpdatesPerSecond));
+
+	// Only queries on components the worker is authoritative over apply.
+	Interest InterestComponent;
+	InterestComponent.ComponentInterestMap.Add(ViewerComponentId, ComponentInterest{ { CreateFullSnapshotQuery(CreateEntityIdConstraint(NearEntityId)) } });
+	InterestComponent.ComponentInterestMap.Add(FirstComponentId, ComponentInterest{ { CreateFullSnapshotQuery(CreateEntityIdConstraint(FarEntityId)) } });
+	const InterestEvaluationResult InterestResult = Evaluator.Evaluate(ViewerEntityId, InterestComponent, { ViewerComponentId });
+	TestTrue(TEXT("Queries on authoritative components apply"), InterestResult.EntityComponents.Contains(NearEntityId));
+	TestFalse(TEXT("Queries on other components don't apply"), InterestResult.EntityComponents.Contains(FarEntityId));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterestEvaluatorFrequencyCapTest, "SpatialGDK.InterestEvaluator.FrequencyCap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FInterestEvaluatorFrequencyCapTest::RunTest(const FString& Parameters)
+{
+	const InterestEvaluator Evaluator = CreateEvaluator();
+	const QueryConstraint Near = CreateEntityIdConstraint(NearEntityId);
+	const TPair<Worker_EntityId_Key, Worker_ComponentId> NearFirstComponent(NearEntityId, FirstComponentId);
+
+	const InterestEvaluationResult CappedResult = Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(Near, FirstComponentId, 10.0f) });
+	TestEqual(TEXT("Frequency caps the update rate"), CappedResult.ComponentUpdatesPerSecond.FindRef(NearFirstComponent), 10.0f);
+	TestEqual(TEXT("Capped estimate"), CappedResult.EstimatedBytesPerSecond, static_cast<double>(BytesPerUpdate * 10.0f));
+
+	const InterestEvaluationResult UncappedResult = Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(Near, FirstComponentId, 60.0f) });
+	TestEqual(TEXT("Frequency above the update rate doesn't raise it"), UncappedResult.ComponentUpdatesPerSecond.FindRef(NearFirstComponent), UpdatesPerSecond);
+
+	const InterestEvaluationResult OverlappingResult = Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(Near, FirstComponentId, 5.0f), CreateComponentQuery(Near, FirstComponentId, 10.0f) });
+	TestEqual(TEXT("Overlapping queries use the highest frequency"), OverlappingResult.ComponentUpdatesPerSecond.FindRef(NearFirstComponent), 10.0f);
+	TestEqual(TEXT("Overlapping queries don't add up"), OverlappingResult.EstimatedBytesPerSecond, static_cast<double>(BytesPerUpdate * 10.0f));
+
+	const InterestEvaluationResult UnlimitedResult = Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(Near, FirstComponentId, 5.0f), CreateComponentQuery(Near, FirstComponentId, TSchemaOption<float>()) });
+	TestEqual(TEXT("An unset frequency wins over any limit"), UnlimitedResult.ComponentUpdatesPerSecond.FindRef(NearFirstComponent), UpdatesPerSecond);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterestEvaluatorMergeRaisesFrequencyTest, "SpatialGDK.InterestEvaluator.MergeRaisesFrequency", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FInterestEvaluatorMergeRaisesFrequencyTest::RunTest(const FString& Parameters)
+{
+	const InterestEvaluator Evaluator = CreateEvaluator();
+	const QueryConstraint Near = CreateEntityIdConstraint(NearEntityId);
+	const TPair<Worker_EntityId_Key, Worker_ComponentId> NearFirstComponent(NearEntityId, FirstComponentId);
+
+	InterestEvaluationResult Result = Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(Near, FirstComponentId, 10.0f) });
+
+	Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(Near, FirstComponentId, 5.0f) }, Result);
+	TestEqual(TEXT("Merging a lower frequency keeps the rate"), Result.ComponentUpdatesPerSecond.FindRef(NearFirstComponent), 10.0f);
+	TestEqual(TEXT("Merging a lower frequency keeps the estimate"), Result.EstimatedBytesPerSecond, static_cast<double>(BytesPerUpdate * 10.0f));
+
+	Evaluator.Evaluate(ViewerEntityId, { CreateComponentQuery(Near, FirstComponentId, 20.0f) }, Result);
+	TestEqual(TEXT("Merging a higher frequency raises the rate"), Result.ComponentUpdatesPerSecond.FindRef(NearFirstComponent), 20.0f);
+	TestEqual(TEXT("Merging a higher frequency raises the estimate"), Result.EstimatedBytesPerSecond, static_cast<double>(BytesPerUpdate * 20.0f));
+	TestEqual(TEXT("Merging doesn't check out the component twice"), Result.GetNumComponents(), 1);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,187 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#include "Utils/LoadAwareOffloadingPolicy.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace SpatialGDK;
+
+namespace
+{
+const int32 HomeWorkerTypeIndex = 0;
+const int32 FirstOffloadWorkerTypeIndex = 1;
+const int32 SecondOffloadWorkerTypeIndex = 2;
+
+const FName FirstActorGroup(TEXT("First"));
+const FName SecondActorGroup(TEXT("Second"));
+
+const float HighLoad = 1.0f;
+const float LowLoad = 0.5f;
+const float MinSecondsBetweenReassignments = 10.0f;
+const float ReportTimeoutSeconds = 1000.0f;
+
+LoadAwareOffloadingPolicy CreatePolicy()
+{
+	TArray<LoadAwareActorGroup> Groups;
+	Groups.Add(LoadAwareActorGroup{ FirstActorGroup, HomeWorkerTypeIndex, FirstOffloadWorkerTypeIndex });
+	Groups.Add(LoadAwareActorGroup{ SecondActorGroup, HomeWorkerTypeIndex, SecondOffloadWorkerTypeIndex });
+	return LoadAwareOffloadingPolicy(Groups, HighLoad, LowLoad, MinSecondsBetweenReassignments, ReportTimeoutSeconds);
+}
+
+// Reports the load of a worker type with a single worker, at a time that doesn't time out in any of the tests.
+void SetWorkerTypeLoad(LoadAwareOffloadingPolicy& Policy, int32 WorkerTypeIndex, double Load)
+{
+	Policy.ReportWorkerLoad(FString::Printf(TEXT("WorkerType%d"), WorkerTypeIndex), WorkerTypeIndex, Load, TSet<FName>(), 0.0);
+}
+
+bool TestReassignment(FAutomationTestBase& Test, const TArray<ActorGroupReassignment>& Reassignments, FName ExpectedActorGroup, int32 ExpectedWorkerTypeIndex)
+{
+	if (!Test.TestEqual(TEXT("Number of reassignments"), Reassignments.Num(), 1))
+	{
+		return false;
+	}
+
+	Test.TestEqual(TEXT("Reassigned actor group"), Reassignments[0].ActorGroup, ExpectedActorGroup);
+	Test.TestEqual(TEXT("Reassigned worker type"), Reassignments[0].WorkerTypeIndex, ExpectedWorkerTypeIndex);
+	return true;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadAwareOffloadingPolicyOffloadsAboveHighLoadTest, "SpatialGDK.LoadAwareOffloadingPolicy.OffloadsAboveHighLoad", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLoadAwareOffloadingPolicyOffloadsAboveHighLoadTest::RunTest(const FString& Parameters)
+{
+	LoadAwareOffloadingPolicy Policy = CreatePolicy();
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, HighLoad);
+	TestEqual(TEXT("Nothing is offloaded at exactly the high load"), Policy.Evaluate(0.0).Num(), 0);
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 1.5);
+	TestReassignment(*this, Policy.Evaluate(0.0), FirstActorGroup, FirstOffloadWorkerTypeIndex);
+	TestTrue(TEXT("First group is offloaded"), Policy.IsOffloaded(FirstActorGroup));
+	TestFalse(TEXT("Second group is not offloaded"), Policy.IsOffloaded(SecondActorGroup));
+
+	TestReassignment(*this, Policy.Evaluate(MinSecondsBetweenReassignments), SecondActorGroup, SecondOffloadWorkerTypeIndex);
+	TestEqual(TEXT("Nothing is left to offload"), Policy.Evaluate(2.0 * MinSecondsBetweenReassignments).Num(), 0);
+
+	LoadAwareOffloadingPolicy OtherPolicy = CreatePolicy();
+	SetWorkerTypeLoad(OtherPolicy, HomeWorkerTypeIndex, 0.75);
+	SetWorkerTypeLoad(OtherPolicy, FirstOffloadWorkerTypeIndex, 1.5);
+	TestEqual(TEXT("Groups are only offloaded for the load of their home worker type"), OtherPolicy.Evaluate(0.0).Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadAwareOffloadingPolicyHoldsBetweenThresholdsTest, "SpatialGDK.LoadAwareOffloadingPolicy.HoldsBetweenThresholds", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLoadAwareOffloadingPolicyHoldsBetweenThresholdsTest::RunTest(const FString& Parameters)
+{
+	LoadAwareOffloadingPolicy Policy = CreatePolicy();
+
+	TestEqual(TEXT("Nothing happens while the home load is unknown"), Policy.Evaluate(0.0).Num(), 0);
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 0.75);
+	TestEqual(TEXT("Nothing is offloaded between the thresholds"), Policy.Evaluate(0.0).Num(), 0);
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 1.5);
+	TestReassignment(*this, Policy.Evaluate(0.0), FirstActorGroup, FirstOffloadWorkerTypeIndex);
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 0.75);
+	TestEqual(TEXT("Nothing is taken back between the thresholds"), Policy.Evaluate(MinSecondsBetweenReassignments).Num(), 0);
+	TestTrue(TEXT("First group stays offloaded"), Policy.IsOffloaded(FirstActorGroup));
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, LowLoad);
+	TestEqual(TEXT("Nothing is taken back at exactly the low load"), Policy.Evaluate(2.0 * MinSecondsBetweenReassignments).Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadAwareOffloadingPolicyTakesBackBelowLowLoadTest, "SpatialGDK.LoadAwareOffloadingPolicy.TakesBackBelowLowLoadInReverseOrder", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLoadAwareOffloadingPolicyTakesBackBelowLowLoadTest::RunTest(const FString& Parameters)
+{
+	LoadAwareOffloadingPolicy Policy = CreatePolicy();
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 1.5);
+	TestReassignment(*this, Policy.Evaluate(0.0), FirstActorGroup, FirstOffloadWorkerTypeIndex);
+	TestReassignment(*this, Policy.Evaluate(MinSecondsBetweenReassignments), SecondActorGroup, SecondOffloadWorkerTypeIndex);
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 0.25);
+	TestReassignment(*this, Policy.Evaluate(2.0 * MinSecondsBetweenReassignments), SecondActorGroup, HomeWorkerTypeIndex);
+	TestFalse(TEXT("Second group is taken back first"), Policy.IsOffloaded(SecondActorGroup));
+	TestTrue(TEXT("First group is still offloaded"), Policy.IsOffloaded(FirstActorGroup));
+
+	TestReassignment(*this, Policy.Evaluate(3.0 * MinSecondsBetweenReassignments), FirstActorGroup, HomeWorkerTypeIndex);
+	TestFalse(TEXT("First group is taken back"), Policy.IsOffloaded(FirstActorGroup));
+
+	TestEqual(TEXT("Nothing is left to take back"), Policy.Evaluate(4.0 * MinSecondsBetweenReassignments).Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadAwareOffloadingPolicyThrottlesReassignmentsTest, "SpatialGDK.LoadAwareOffloadingPolicy.ThrottlesReassignments", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLoadAwareOffloadingPolicyThrottlesReassignmentsTest::RunTest(const FString& Parameters)
+{
+	LoadAwareOffloadingPolicy Policy = CreatePolicy();
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 1.5);
+	TestReassignment(*this, Policy.Evaluate(100.0), FirstActorGroup, FirstOffloadWorkerTypeIndex);
+	TestEqual(TEXT("Nothing is offloaded again within the minimum time"), Policy.Evaluate(100.0 + MinSecondsBetweenReassignments - 0.5).Num(), 0);
+	TestFalse(TEXT("Second group is not offloaded within the minimum time"), Policy.IsOffloaded(SecondActorGroup));
+
+	TestReassignment(*this, Policy.Evaluate(100.0 + MinSecondsBetweenReassignments), SecondActorGroup, SecondOffloadWorkerTypeIndex);
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 0.25);
+	TestEqual(TEXT("Nothing is taken back within the minimum time"), Policy.Evaluate(100.0 + 1.5 * MinSecondsBetweenReassignments).Num(), 0);
+	TestReassignment(*this, Policy.Evaluate(100.0 + 2.0 * MinSecondsBetweenReassignments), SecondActorGroup, HomeWorkerTypeIndex);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadAwareOffloadingPolicySkipsLoadedOffloadTargetTest, "SpatialGDK.LoadAwareOffloadingPolicy.SkipsLoadedOffloadTarget", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLoadAwareOffloadingPolicySkipsLoadedOffloadTargetTest::RunTest(const FString& Parameters)
+{
+	LoadAwareOffloadingPolicy Policy = CreatePolicy();
+
+	SetWorkerTypeLoad(Policy, HomeWorkerTypeIndex, 1.5);
+	SetWorkerTypeLoad(Policy, FirstOffloadWorkerTypeIndex, LowLoad);
+	TestReassignment(*this, Policy.Evaluate(0.0), SecondActorGroup, SecondOffloadWorkerTypeIndex);
+	TestFalse(TEXT("Group whose target is at the low load is not offloaded"), Policy.IsOffloaded(FirstActorGroup));
+
+	SetWorkerTypeLoad(Policy, FirstOffloadWorkerTypeIndex, 0.9);
+	TestEqual(TEXT("Group whose target is above the low load is not offloaded"), Policy.Evaluate(MinSecondsBetweenReassignments).Num(), 0);
+
+	SetWorkerTypeLoad(Policy, FirstOffloadWorkerTypeIndex, 0.25);
+	TestReassignment(*this, Policy.Evaluate(2.0 * MinSecondsBetweenReassignments), FirstActorGroup, FirstOffloadWorkerTypeIndex);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadAwareOffloadingPolicyAveragesWorkerLoadsTest, "SpatialGDK.LoadAwareOffloadingPolicy.AveragesWorkerLoads", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLoadAwareOffloadingPolicyAveragesWorkerLoadsTest::RunTest(const FString& Parameters)
+{
+	LoadAwareOffloadingPolicy Policy = CreatePolicy();
+
+	Policy.ReportWorkerLoad(TEXT("HomeWorker1"), HomeWorkerTypeIndex, 1.5, TSet<FName>(), 0.0);
+	Policy.ReportWorkerLoad(TEXT("HomeWorker2"), HomeWorkerTypeIndex, 0.25, TSet<FName>(), 0.0);
+	TestEqual(TEXT("One overloaded worker doesn't offload the groups of its whole type"), Policy.Evaluate(0.0).Num(), 0);
+
+	Policy.ReportWorkerLoad(TEXT("HomeWorker2"), HomeWorkerTypeIndex, 1.25, TSet<FName>(), 0.0);
+	TestReassignment(*this, Policy.Evaluate(0.0), FirstActorGroup, FirstOffloadWorkerTypeIndex);
+
+	Policy.ReportWorkerLoad(TEXT("HomeWorker1"), HomeWorkerTypeIndex, 0.25, TSet<FName>(), ReportTimeoutSeconds + 1.0);
+	TestReassignment(*this, Policy.Evaluate(ReportTimeoutSeconds + 1.0), FirstActorGroup, HomeWorkerTypeIndex);
+	TestFalse(TEXT("Reports older than the timeout are ignored"), Policy.IsOffloaded(FirstActorGroup));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadAwareOffloadingPolicyKeepsOwnedActorGroupsHomeTest, "SpatialGDK.LoadAwareOffloadingPolicy.KeepsOwnedActorGroupsHome", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FLoadAwareOffloadingPolicyKeepsOwnedActorGroupsHomeTest::RunTest(const FString& Parameters)
+{
+	LoadAwareOffloadingPolicy Policy = CreatePolicy();
+
+	Policy.ReportWorkerLoad(TEXT("HomeWorker"), HomeWorkerTypeIndex, 1.5, TSet<FName>{ FirstActorGroup }, 0.0);
+	TestReassignment(*this, Policy.Evaluate(0.0), SecondActorGroup, SecondOffloadWorkerTypeIndex);
+	TestFalse(TEXT("Group with owned Actors is not offloaded"), Policy.IsOffloaded(FirstActorGroup));
+
+	Policy.ReportWorkerLoad(TEXT("OffloadWorker"), SecondOffloadWorkerTypeIndex, 0.25, TSet<FName>{ SecondActorGroup }, 0.0);
+	TestReassignment(*this, Policy.Evaluate(1.0), SecondActorGroup, HomeWorkerTypeIndex);
+	TestFalse(TEXT("Offloaded group gaining owned Actors is taken back within the minimum time"), Policy.IsOffloaded(SecondActorGroup));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,113 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Misc/AutomationTest.h"
+
+#include "Engine/EngineTypes.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+
+#include "Utils/SpatialActorGrid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+const float CellSize = 1000.0f;
+const float CullDistance = 1200.0f;
+
+// The grid only uses Actors as keys, so class default objects stand in for spawned Actors.
+const AActor* FirstActor = nullptr;
+const AActor* SecondActor = nullptr;
+
+FNetViewer CreateViewer(const FVector& ViewLocation)
+{
+	FNetViewer Viewer;
+	Viewer.ViewLocation = ViewLocation;
+	return Viewer;
+}
+
+FSpatialActorGrid CreateGrid(const TArray<FNetViewer>& Viewers)
+{
+	FirstActor = GetDefault<AActor>();
+	SecondActor = GetDefault<APawn>();
+
+	FSpatialActorGrid Grid;
+	Grid.SetCellSize(CellSize);
+	Grid.UpdateViewers(Viewers, CullDistance);
+	return Grid;
+}
+
+bool HasViewer(const FSpatialActorGrid& Grid, const AActor* Actor, int32 ViewerIndex)
+{
+	const FSpatialActorGrid::FViewerIndices* Viewers = Grid.GetViewersForActor(Actor);
+	return Viewers != nullptr && Viewers->Contains(ViewerIndex);
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpatialActorGridViewerCellsTest, "SpatialGDK.SpatialActorGrid.ViewerCells", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FSpatialActorGridViewerCellsTest::RunTest(const FString& Parameters)
+{
+	FSpatialActorGrid Grid = CreateGrid({ CreateViewer(FVector::ZeroVector), CreateViewer(FVector(3000.0f, 0.0f, 0.0f)) });
+
+	Grid.UpdateActor(FirstActor, FVector(500.0f, 500.0f, 0.0f));
+	TestTrue(TEXT("Actor in the viewer's cell is covered by it"), HasViewer(Grid, FirstActor, 0));
+	TestFalse(TEXT("Actor far from a viewer isn't covered by it"), HasViewer(Grid, FirstActor, 1));
+
+	Grid.UpdateActor(FirstActor, FVector(1500.0f, 500.0f, 0.0f));
+	TestTrue(TEXT("Cell within the cull distance of both viewers is covered by the first"), HasViewer(Grid, FirstActor, 0));
+	TestTrue(TEXT("Cell within the cull distance of both viewers is covered by the second"), HasViewer(Grid, FirstActor, 1));
+
+	Grid.UpdateActor(FirstActor, FVector(-1500.0f, -1500.0f, 0.0f));
+	TestNull(TEXT("Corner cells outside the cull distance aren't covered"), Grid.GetViewersForActor(FirstActor));
+
+	Grid.UpdateActor(FirstActor, FVector(500.0f, 500.0f, 100000.0f));
+	TestTrue(TEXT("Height doesn't affect the cell"), HasViewer(Grid, FirstActor, 0));
+
+	TestNull(TEXT("Untracked Actors aren't covered"), Grid.GetViewersForActor(SecondActor));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpatialActorGridRebucketsMovedActorsTest, "SpatialGDK.SpatialActorGrid.RebucketsMovedActors", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FSpatialActorGridRebucketsMovedActorsTest::RunTest(const FString& Parameters)
+{
+	FSpatialActorGrid Grid = CreateGrid({ CreateViewer(FVector::ZeroVector) });
+
+	const FVector FarLocation(10000.0f, 0.0f, 0.0f);
+	Grid.UpdateActor(FirstActor, FarLocation);
+	TestTrue(TEXT("Actor is tracked after its first update"), Grid.IsTracked(FirstActor));
+	TestNull(TEXT("Actor far from every viewer is culled"), Grid.GetViewersForActor(FirstActor));
+
+	const FVector NearLocation(100.0f, 0.0f, 0.0f);
+	Grid.UpdateActor(FirstActor, NearLocation);
+	TestTrue(TEXT("Culled Actor moving into view is covered once its position is updated"), HasViewer(Grid, FirstActor, 0));
+	if (TestNotNull(TEXT("Tracked Actor has a location"), Grid.GetActorLocation(FirstActor)))
+	{
+		TestEqual(TEXT("Location is the last one the Actor was updated with"), *Grid.GetActorLocation(FirstActor), NearLocation);
+	}
+
+	Grid.UpdateViewers({ CreateViewer(FarLocation) }, CullDistance);
+	TestNull(TEXT("Actor is culled once the viewer moves away"), Grid.GetViewersForActor(FirstActor));
+
+	Grid.RemoveActor(FirstActor);
+	TestFalse(TEXT("Removed Actor isn't tracked"), Grid.IsTracked(FirstActor));
+	TestNull(TEXT("Removed Actor has no location"), Grid.GetActorLocation(FirstActor));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpatialActorGridCellSizeChangeTest, "SpatialGDK.SpatialActorGrid.CellSizeChange", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FSpatialActorGridCellSizeChangeTest::RunTest(const FString& Parameters)
+{
+	FSpatialActorGrid Grid = CreateGrid({ CreateViewer(FVector::ZeroVector) });
+	Grid.UpdateActor(FirstActor, FVector::ZeroVector);
+	Grid.UpdateActor(SecondActor, FVector::ZeroVector);
+
+	Grid.SetCellSize(CellSize);
+	TestTrue(TEXT("Setting the same cell size keeps the Actors"), Grid.IsTracked(FirstActor));
+
+	Grid.SetCellSize(2.0f * CellSize);
+	TestFalse(TEXT("Changing the cell size drops the first Actor"), Grid.IsTracked(FirstActor));
+	TestFalse(TEXT("Changing the cell size drops the second Actor"), Grid.IsTracked(SecondActor));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,76 +1,127 @@
 #include "Utils/ActorGroupManager.h"
 #include "SpatialGDKSettings.h"
 
+DEFINE_LOG_CATEGORY(LogActorGroupManager);
+
 void UActorGroupManager::Init()
 {
 	if (const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>())
 	{
-		DefaultWorkerType = Settings->DefaultWorkerType.WorkerTypeName;
-		if (Settings->bEnableOffloading)
+		Init(*Settings);
+	}
+}
+
+void UActorGroupManager::Init(const USpatialGDKSettings& Settings)
+{
+	DefaultWorkerType = Settings.DefaultWorkerType.WorkerTypeName;
+	FindOrAddWorkerTypeIndex(DefaultWorkerType);
+
+	if (Settings.bEnableOffloading)
+	{
+		TArray<SpatialGDK::LoadAwareActorGroup> LoadAwareActorGroups;
+
+		for (const TPair<FName, FActorGroupInfo>& ActorGroup : Settings.ActorGroups)
 		{
-			for (const TPair<FName, FActorGroupInfo>& ActorGroup : Settings->ActorGroups)
+			const int32 WorkerTypeIndex = FindOrAddWorkerTypeIndex(ActorGroup.Value.OwningWorkerType.WorkerTypeName);
+			ActorGroupToWorkerTypeIndex.Add(ActorGroup.Key, WorkerTypeIndex);
+			ActorGroupToHomeWorkerTypeIndex.Add(ActorGroup.Key, WorkerTypeIndex);
+
+			for (const TSoftClassPtr<AActor>& ClassPtr : ActorGroup.Value.ActorClasses)
 			{
-				ActorGroupToWorkerType.Add(ActorGroup.Key, ActorGroup.Value.OwningWorkerType.WorkerTypeName);
+				ClassPathToActorGroup.Add(ClassPtr, ActorGroup.Key);
+			}
 
-				for (const TSoftClassPtr<AActor>& ClassPtr : ActorGroup.Value.ActorClasses)
-				{
-					ClassPathToActorGroup.Add(ClassPtr, ActorGroup.Key);
-				}
+			const FName OffloadWorkerType = ActorGroup.Value.LoadAwareOffloadWorkerType.WorkerTypeName;
+			if (Settings.bEnableLoadAwareOffloading && OffloadWorkerType != NAME_None && OffloadWorkerType != ActorGroup.Value.OwningWorkerType.WorkerTypeName)
+			{
+				LoadAwareActorGroups.Add(SpatialGDK::LoadAwareActorGroup{ ActorGroup.Key, WorkerTypeIndex, FindOrAddWorkerTypeIndex(OffloadWorkerType) });
 			}
 		}
+
+		// Workers report their load once per metrics report, so a worker which missed a few reports is assumed to be gone.
+		LoadAwareOffloading = SpatialGDK::LoadAwareOffloadingPolicy(LoadAwareActorGroups, Settings.LoadAwareOffloadingHighLoad,
+			Settings.LoadAwareOffloadingLowLoad, Settings.LoadAwareOffloadingMinSecondsBetweenReassignments, 3.0f * Settings.MetricsReportRate);
 	}
 }
 
-FName UActorGroupManager::GetActorGroupForClass(const TSubclassOf<AActor> Class)
+int32 UActorGroupManager::FindOrAddWorkerTypeIndex(FName WorkerType)
+{
+	const int32 WorkerTypeIndex = WorkerTypes.Find(WorkerType);
+	return WorkerTypeIndex != INDEX_NONE ? WorkerTypeIndex : WorkerTypes.Add(WorkerType);
+}
+
+FActorGroupAssignment UActorGroupManager::GetActorGroupAssignmentForClass(const TSubclassOf<AActor> Class)
 {
 	if (Class == nullptr)
 	{
-		return NAME_None;
+		return FActorGroupAssignment{ NAME_None, 0 };
 	}
 
-	UClass* FoundClass = Class;
-	TSoftClassPtr<AActor> ClassPtr = TSoftClassPtr<AActor>(FoundClass);
+	if (const FActorGroupAssignment* CachedAssignment = ClassToActorGroupAssignment.Find(Class.Get()))
+	{
+		return *CachedAssignment;
+	}
 
+	FName ActorGroup = SpatialConstants::DefaultActorGroup;
+
+	UClass* FoundClass = Class;
 	while (FoundClass != nullptr && FoundClass->IsChildOf(AActor::StaticClass()))
 	{
-		if (const FName* ActorGroup = ClassPathToActorGroup.Find(ClassPtr))
+		if (FoundClass != Class)
 		{
-			if (FoundClass != Class)
+			// A parent class that was already resolved has the group for the rest of the chain.
+			if (const FActorGroupAssignment* ParentAssignment = ClassToActorGroupAssignment.Find(FoundClass))
 			{
-				ClassPathToActorGroup.Add(TSoftClassPtr<AActor>(Class), *ActorGroup);
+				ActorGroup = ParentAssignment->ActorGroup;
+				break;
 			}
-			return *ActorGroup;
+		}
+
+		if (const FName* FoundActorGroup = ClassPathToActorGroup.Find(TSoftClassPtr<AActor>(FoundClass)))
+		{
+			ActorGroup = *FoundActorGroup;
+			break;
 		}
 
 		FoundClass = FoundClass->GetSuperClass();
-		ClassPtr = TSoftClassPtr<AActor>(FoundClass);
 	}
 
-	// No mapping found so set and return default actor group.
-	ClassPathToActorGroup.Add(TSoftClassPtr<AActor>(Class), SpatialConstants::DefaultActorGroup);
-	return SpatialConstants::DefaultActorGroup;
+	return ClassToActorGroupAssignment.Add(Class.Get(), FActorGroupAssignment{ ActorGroup, GetWorkerTypeIndexForActorGroup(ActorGroup) });
+}
+
+FName UActorGroupManager::GetActorGroupForClass(const TSubclassOf<AActor> Class)
+{
+	return GetActorGroupAssignmentForClass(Class).ActorGroup;
 }
 
 FName UActorGroupManager::GetWorkerTypeForClass(const TSubclassOf<AActor> Class)
 {
-	const FName ActorGroup = GetActorGroupForClass(Class);
+	return WorkerTypes[GetActorGroupAssignmentForClass(Class).WorkerTypeIndex];
+}
 
-	if (const FName* WorkerType = ActorGroupToWorkerType.Find(ActorGroup))
+FName UActorGroupManager::GetWorkerTypeForActorGroup(const FName& ActorGroup) const
+{
+	return WorkerTypes[GetWorkerTypeIndexForActorGroup(ActorGroup)];
+}
+
+FName UActorGroupManager::GetHomeWorkerTypeForActorGroup(const FName& ActorGroup) const
+{
+	if (const int32* WorkerTypeIndex = ActorGroupToHomeWorkerTypeIndex.Find(ActorGroup))
 	{
-		return *WorkerType;
+		return WorkerTypes[*WorkerTypeIndex];
 	}
 
 	return DefaultWorkerType;
 }
 
-FName UActorGroupManager::GetWorkerTypeForActorGroup(const FName& ActorGroup) const
+int32 UActorGroupManager::GetWorkerTypeIndexForActorGroup(const FName& ActorGroup) const
 {
-	if (const FName* WorkerType = ActorGroupToWorkerType.Find(ActorGroup))
+	if (const int32* WorkerTypeIndex = ActorGroupToWorkerTypeIndex.Find(ActorGroup))
 	{
-		return *WorkerType;
+		return *WorkerTypeIndex;
 	}
 
-	return DefaultWorkerType;
+	return 0;
 }
 
 bool UActorGroupManager::IsSameWorkerType(const AActor* ActorA, const AActor* ActorB)
@@ -80,8 +131,98 @@ bool UActorGroupManager::IsSameWorkerType(const AActor* ActorA, const AActor* Ac
 		return false;
 	}
 
-	const FName& WorkerTypeA = GetWorkerTypeForClass(ActorA->GetClass());
-	const FName& WorkerTypeB = GetWorkerTypeForClass(ActorB->GetClass());
+	return GetActorGroupAssignmentForClass(ActorA->GetClass()).WorkerTypeIndex == GetActorGroupAssignmentForClass(ActorB->GetClass()).WorkerTypeIndex;
+}
+
+void UActorGroupManager::SetWorkerTypeIndexForActorGroup(FName ActorGroup, int32 WorkerTypeIndex)
+{
+	ActorGroupToWorkerTypeIndex.Add(ActorGroup, WorkerTypeIndex);
+
+	for (auto& ClassAssignmentPair : ClassToActorGroupAssignment)
+	{
+		if (ClassAssignmentPair.Value.ActorGroup == ActorGroup)
+		{
+			ClassAssignmentPair.Value.WorkerTypeIndex = WorkerTypeIndex;
+		}
+	}
+}
+
+void UActorGroupManager::ReportWorkerLoad(const FString& WorkerId, FName WorkerType, double Load, const TArray<FString>& OwnedActorGroups, double Now)
+{
+	const int32 WorkerTypeIndex = GetWorkerTypeIndex(WorkerType);
+	if (WorkerTypeIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	TSet<FName> OwnedActorGroupNames;
+	for (const FString& ActorGroup : OwnedActorGroups)
+	{
+		OwnedActorGroupNames.Add(FName(*ActorGroup));
+	}
+
+	LoadAwareOffloading.ReportWorkerLoad(WorkerId, WorkerTypeIndex, Load, OwnedActorGroupNames, Now);
+}
+
+TArray<SpatialGDK::ActorGroupReassignment> UActorGroupManager::UpdateLoadAwareOffloading(double Now)
+{
+	TArray<SpatialGDK::ActorGroupReassignment> Reassignments = LoadAwareOffloading.Evaluate(Now);
+	for (const SpatialGDK::ActorGroupReassignment& Reassignment : Reassignments)
+	{
+		UE_LOG(LogActorGroupManager, Log, TEXT("Load-aware offloading: moving actor group %s to worker type %s."),
+			*Reassignment.ActorGroup.ToString(), *WorkerTypes[Reassignment.WorkerTypeIndex].ToString());
+	}
+
+	return Reassignments;
+}
+
+void UActorGroupManager::AddReassignmentsToOffloadedActorGroups(const TArray<SpatialGDK::ActorGroupReassignment>& Reassignments, TMap<FString, FString>& InOutOffloadedActorGroupToWorkerType) const
+{
+	for (const SpatialGDK::ActorGroupReassignment& Reassignment : Reassignments)
+	{
+		const FName WorkerType = WorkerTypes[Reassignment.WorkerTypeIndex];
+		if (WorkerType == GetHomeWorkerTypeForActorGroup(Reassignment.ActorGroup))
+		{
+			InOutOffloadedActorGroupToWorkerType.Remove(Reassignment.ActorGroup.ToString());
+		}
+		else
+		{
+			InOutOffloadedActorGroupToWorkerType.Add(Reassignment.ActorGroup.ToString(), WorkerType.ToString());
+		}
+	}
+}
+
+TArray<FName> UActorGroupManager::ApplyActorGroupAssignments(const TMap<FString, FString>& OffloadedActorGroupToWorkerType)
+{
+	TArray<FName> ReassignedActorGroups;
+
+	for (const TPair<FName, int32>& ActorGroupHomePair : ActorGroupToHomeWorkerTypeIndex)
+	{
+		const FName ActorGroup = ActorGroupHomePair.Key;
+
+		int32 WorkerTypeIndex = ActorGroupHomePair.Value;
+		if (const FString* OffloadWorkerType = OffloadedActorGroupToWorkerType.Find(ActorGroup.ToString()))
+		{
+			WorkerTypeIndex = GetWorkerTypeIndex(FName(**OffloadWorkerType));
+			if (WorkerTypeIndex == INDEX_NONE)
+			{
+				UE_LOG(LogActorGroupManager, Error, TEXT("Actor group %s is offloaded to unknown worker type %s, keeping it on worker type %s."),
+					*ActorGroup.ToString(), **OffloadWorkerType, *GetWorkerTypeForActorGroup(ActorGroup).ToString());
+				continue;
+			}
+		}
+
+		// Keep the policy in step, in case this worker makes the next decisions.
+		LoadAwareOffloading.SetOffloaded(ActorGroup, WorkerTypeIndex != ActorGroupHomePair.Value);
+
+		if (WorkerTypeIndex != GetWorkerTypeIndexForActorGroup(ActorGroup))
+		{
+			UE_LOG(LogActorGroupManager, Log, TEXT("Actor group %s is now on worker type %s."), *ActorGroup.ToString(), *WorkerTypes[WorkerTypeIndex].ToString());
+
+			SetWorkerTypeIndexForActorGroup(ActorGroup, WorkerTypeIndex);
+			ReassignedActorGroups.Add(ActorGroup);
+		}
+	}
 
-	return (WorkerTypeA == WorkerTypeB);
+	return ReassignedActorGroups;
 }
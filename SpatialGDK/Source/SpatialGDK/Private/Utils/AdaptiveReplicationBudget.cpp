@@ -0,0 +1,68 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/AdaptiveReplicationBudget.h"
+
+namespace
+{
+// The budget never drops below this fraction of the target time, so that replication always makes some progress.
+const double MinBudgetFraction = 0.1;
+
+// Fraction of the difference between the current and desired budget recovered each tick.
+const double BudgetRecoveryRate = 0.25;
+}
+
+FAdaptiveReplicationBudget::FAdaptiveReplicationBudget()
+	: TargetTime(0.0)
+	, Budget(0.0)
+	, ServerReplicateActorsTime(0.0)
+	, ReplicationLoopTime(0.0)
+	, NumQueuedMessages(0)
+	, NumDeferredActors(0)
+{
+}
+
+void FAdaptiveReplicationBudget::SetTargetTime(double InTargetTime)
+{
+	if (InTargetTime == TargetTime)
+	{
+		return;
+	}
+
+	TargetTime = InTargetTime;
+	Budget = TargetTime;
+}
+
+void FAdaptiveReplicationBudget::RecordReplicationLoop(double InReplicationLoopTime, int32 InNumDeferredActors)
+{
+	ReplicationLoopTime = InReplicationLoopTime;
+	NumDeferredActors = InNumDeferredActors;
+}
+
+void FAdaptiveReplicationBudget::Update(double InServerReplicateActorsTime, int32 InNumQueuedMessages, int32 MaxQueuedMessages)
+{
+	ServerReplicateActorsTime = InServerReplicateActorsTime;
+	NumQueuedMessages = InNumQueuedMessages;
+
+	const double MinBudget = TargetTime * MinBudgetFraction;
+
+	// Time spent in ServerReplicateActors that the budget doesn't control.
+	const double Overhead = FMath::Max(0.0, ServerReplicateActorsTime - ReplicationLoopTime);
+	double DesiredBudget = TargetTime - Overhead;
+
+	// Back off while the runtime isn't keeping up with what we've already sent.
+	if (MaxQueuedMessages > 0 && NumQueuedMessages > MaxQueuedMessages)
+	{
+		DesiredBudget *= static_cast<double>(MaxQueuedMessages) / NumQueuedMessages;
+	}
+
+	DesiredBudget = FMath::Max(DesiredBudget, MinBudget);
+
+	if (DesiredBudget < Budget)
+	{
+		Budget = DesiredBudget;
+	}
+	else
+	{
+		Budget += (DesiredBudget - Budget) * BudgetRecoveryRate;
+	}
+}
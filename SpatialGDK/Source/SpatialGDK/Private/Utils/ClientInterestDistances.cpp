@@ -0,0 +1,177 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ClientInterestDistances.h"
+
+#include "GameFramework/Actor.h"
+
+#include "SpatialGDKSettings.h"
+#include "Utils/InterestFactory.h"
+#include "Utils/SchemaDatabase.h"
+
+namespace
+{
+// Returns false if the class doesn't need a client interest distance larger than the default.
+bool GetClientInterestDistanceSquared(UClass* Class, float& OutDistanceSquared)
+{
+	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly | SPATIALCLASS_NotSpatialType))
+	{
+		return false;
+	}
+	if (Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+	{
+		// This skips classes generated for hot reload etc (i.e. REINST_, SKEL_, TRASHCLASS_)
+		return false;
+	}
+	if (!Class->IsChildOf<AActor>())
+	{
+		return false;
+	}
+
+	const AActor* DefaultActor = GetDefault<AActor>();
+	const AActor* ClassDefaultActor = Cast<AActor>(Class->GetDefaultObject());
+	if (ClassDefaultActor->NetCullDistanceSquared <= DefaultActor->NetCullDistanceSquared)
+	{
+		return false;
+	}
+
+	OutDistanceSquared = ClassDefaultActor->NetCullDistanceSquared;
+
+	const float MaxDistanceSquared = GetDefault<USpatialGDKSettings>()->MaxNetCullDistanceSquared;
+	if (MaxDistanceSquared != 0.f && OutDistanceSquared > MaxDistanceSquared)
+	{
+		UE_LOG(LogInterestFactory, Warning, TEXT("NetCullDistanceSquared for %s too large, clamping from %f to %f"),
+			*Class->GetName(), OutDistanceSquared, MaxDistanceSquared);
+
+		OutDistanceSquared = MaxDistanceSquared;
+	}
+
+	return true;
+}
+}
+
+namespace SpatialGDK
+{
+
+void ClientInterestDistances::Gather(const USchemaDatabase& SchemaDatabase)
+{
+	TSet<UClass*> Classes;
+	TMap<UClass*, float> Discovered;
+
+	// Gather ClientInterestDistance settings for the loaded Actor classes which have schema.
+	// Classes loaded later are added through AddClass when they are registered with the class info manager.
+	SchemaDatabase.GetCompactSchemaDatabase().ForEachActorClassPath([&Classes, &Discovered](const FString& ClassPath)
+	{
+		UClass* Class = FSoftClassPath(ClassPath).ResolveClass();
+		if (Class == nullptr)
+		{
+			return;
+		}
+
+		Classes.Add(Class);
+
+		float DistanceSquared;
+		if (GetClientInterestDistanceSquared(Class, DistanceSquared))
+		{
+			Discovered.Add(Class, DistanceSquared);
+		}
+	});
+
+	Gather(Discovered);
+	ProcessedClasses.Append(Classes);
+}
+
+void ClientInterestDistances::Gather(const TMap<UClass*, float>& InDiscoveredDistancesSquared)
+{
+	DiscoveredDistancesSquared = InDiscoveredDistancesSquared;
+
+	ProcessedClasses.Reset();
+	DistancesSquared.Reset();
+	for (const auto& DiscoveredDistance : DiscoveredDistancesSquared)
+	{
+		ProcessedClasses.Add(DiscoveredDistance.Key);
+
+		if (!IsCoveredByParentClass(DiscoveredDistance.Key, DiscoveredDistance.Value))
+		{
+			DistancesSquared.Add(DiscoveredDistance.Key, DiscoveredDistance.Value);
+		}
+	}
+
+	bGathered = true;
+	bClassConstraintsDirty = true;
+}
+
+void ClientInterestDistances::AddClass(UClass* Class)
+{
+	if (!bGathered || ProcessedClasses.Contains(Class))
+	{
+		return;
+	}
+
+	ProcessedClasses.Add(Class);
+
+	float DistanceSquared;
+	if (GetClientInterestDistanceSquared(Class, DistanceSquared))
+	{
+		AddDiscoveredClass(Class, DistanceSquared);
+	}
+}
+
+void ClientInterestDistances::AddClass(UClass* Class, float DistanceSquared)
+{
+	if (!bGathered || ProcessedClasses.Contains(Class))
+	{
+		return;
+	}
+
+	ProcessedClasses.Add(Class);
+	AddDiscoveredClass(Class, DistanceSquared);
+}
+
+const TArray<QueryConstraint>& ClientInterestDistances::GetClassConstraints(TFunctionRef<bool(UClass*, float, QueryConstraint&)> BuildConstraint)
+{
+	if (bClassConstraintsDirty)
+	{
+		ClassConstraints.Reset();
+		for (const auto& DistanceSquared : DistancesSquared)
+		{
+			QueryConstraint Constraint;
+			if (BuildConstraint(DistanceSquared.Key, DistanceSquared.Value, Constraint))
+			{
+				ClassConstraints.Add(Constraint);
+			}
+		}
+		bClassConstraintsDirty = false;
+	}
+
+	return ClassConstraints;
+}
+
+void ClientInterestDistances::AddDiscoveredClass(UClass* Class, float DistanceSquared)
+{
+	DiscoveredDistancesSquared.Add(Class, DistanceSquared);
+
+	// A class can't be loaded before its parent classes, so a new class never makes an existing entry redundant.
+	if (!IsCoveredByParentClass(Class, DistanceSquared))
+	{
+		DistancesSquared.Add(Class, DistanceSquared);
+		bClassConstraintsDirty = true;
+	}
+}
+
+// If an actor's interest distance is smaller than that of a parent class, there's no need to add interest for that actor.
+// It's enough to check the discovered parent classes, as a parent class covered by its own parent class is covered transitively.
+bool ClientInterestDistances::IsCoveredByParentClass(UClass* Class, float DistanceSquared) const
+{
+	for (UClass* SuperClass = Class->GetSuperClass(); SuperClass != nullptr; SuperClass = SuperClass->GetSuperClass())
+	{
+		const float* SuperDistanceSquared = DiscoveredDistancesSquared.Find(SuperClass);
+		if (SuperDistanceSquared != nullptr && DistanceSquared <= *SuperDistanceSquared)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} // namespace SpatialGDK
@@ -419,7 +419,17 @@ TArray<Worker_ComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 	if (Object->IsA<AActor>() && bInterestHasChanged)
 	{
 		InterestFactory InterestUpdateFactory(Cast<AActor>(Object), Info, NetDriver);
-		ComponentUpdates.Add(InterestUpdateFactory.CreateInterestUpdate());
+
+		// Skip the update if the Interest is the same as last sent for this entity.
+		USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId);
+		LastSentInterest UnknownSentInterest;
+		LastSentInterest& SentInterest = Channel != nullptr ? Channel->SentInterest : UnknownSentInterest;
+
+		Worker_ComponentUpdate InterestUpdate;
+		if (InterestUpdateFactory.CreateInterestUpdate(SentInterest, InterestUpdate))
+		{
+			ComponentUpdates.Add(InterestUpdate);
+		}
 	}
 
 	return ComponentUpdates;
@@ -11,25 +11,51 @@ DEFINE_LOG_CATEGORY(LogSpatialEntityPool);
 
 using namespace SpatialGDK;
 
+namespace
+{
+uint32 GetNumRemainingEntityIdsInRange(const EntityRange& Range)
+{
+	return static_cast<uint32>(Range.LastEntityId - Range.CurrentEntityId + 1);
+}
+
+// Weight given to the newest sample when smoothing the consumption rate and reservation round trip time.
+const double ENTITY_POOL_SMOOTHING_FACTOR = 0.5;
+
+// Reserve enough entity IDs to last this many reservation round trips at the current consumption rate.
+const double ENTITY_POOL_ROUND_TRIPS_OF_HEADROOM = 2.0;
+}
+
 void UEntityPool::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
 {
 	NetDriver = InNetDriver;
 	Receiver = InNetDriver->Receiver;
 	TimerManager = InTimerManager;
 
+	NumRemainingEntityIds = 0;
+	NumPendingRequests = 0;
+	NumPendingEntityIds = 0;
+	ConsumptionRate = 0.0;
+	ConsumptionSampleStartTime = FPlatformTime::Seconds();
+	NumConsumedSinceSample = 0;
+	ReservationRoundTripSeconds = 0.0;
+	NumStarvedAllocations = 0;
+
 	ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolInitialReservationCount);
 }
 
 void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 {
-	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Sending bulk entity ID Reservation Request for %d IDs"), EntitiesToReserve);
+	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Sending bulk entity ID Reservation Request for %d IDs, %u requests already in flight"), EntitiesToReserve, NumPendingRequests);
 
-	checkf(!bIsAwaitingResponse, TEXT("Trying to reserve Entity IDs while another reserve request is in flight"));
+	const double RequestTime = FPlatformTime::Seconds();
 
 	// Set up reserve IDs delegate
 	ReserveEntityIDsDelegate CacheEntityIDsDelegate;
-	CacheEntityIDsDelegate.BindLambda([EntitiesToReserve, this](const Worker_ReserveEntityIdsResponseOp& Op)
+	CacheEntityIDsDelegate.BindLambda([EntitiesToReserve, RequestTime, this](const Worker_ReserveEntityIdsResponseOp& Op)
 	{
+		NumPendingRequests--;
+		NumPendingEntityIds -= EntitiesToReserve;
+
 		if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 		{
 			// UNR-630 - Temporary hack to avoid failure to reserve entities due to timeout on large maps
@@ -49,10 +75,20 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 		// Ensure we received the same number of reserved IDs as we requested
 		check(EntitiesToReserve == Op.number_of_entity_ids);
 
+		const double RoundTripSeconds = FPlatformTime::Seconds() - RequestTime;
+		ReservationRoundTripSeconds = ReservationRoundTripSeconds > 0.0 ? FMath::Lerp(ReservationRoundTripSeconds, RoundTripSeconds, ENTITY_POOL_SMOOTHING_FACTOR) : RoundTripSeconds;
+
 		// Clean up any expired Entity ranges
-		ReservedEntityIDRanges = ReservedEntityIDRanges.FilterByPredicate([](const EntityRange& Element)
+		for (const EntityRange& Range : ReservedEntityIDRanges)
 		{
-			return !Element.bExpired;
+			if (Range.bExpired)
+			{
+				NumRemainingEntityIds -= GetNumRemainingEntityIdsInRange(Range);
+			}
+		}
+		ReservedEntityIDRanges.RemoveAll([](const EntityRange& Element)
+		{
+			return Element.bExpired;
 		});
 
 		EntityRange NewEntityRange = {};
@@ -63,6 +99,7 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Reserved %d entities, caching in pool, Entity IDs: (%d, %d) Range ID: %d"), Op.number_of_entity_ids, Op.first_entity_id, NewEntityRange.LastEntityId, NewEntityRange.EntityRangeId);
 
 		ReservedEntityIDRanges.Add(NewEntityRange);
+		NumRemainingEntityIds += Op.number_of_entity_ids;
 
 		FTimerHandle ExpirationTimer;
 		TWeakObjectPtr<UEntityPool> WeakThis(this);
@@ -74,7 +111,6 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 			}
 		}, SpatialConstants::ENTITY_RANGE_EXPIRATION_INTERVAL_SECONDS, false);
 
-		bIsAwaitingResponse = false;
 		if (!bIsReady)
 		{
 			bIsReady = true;
@@ -83,7 +119,8 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 
 	// Reserve the Entity IDs
 	Worker_RequestId ReserveRequestID = NetDriver->Connection->SendReserveEntityIdsRequest(EntitiesToReserve);
-	bIsAwaitingResponse = true;
+	NumPendingRequests++;
+	NumPendingEntityIds += EntitiesToReserve;
 
 	// Add the spawn delegate
 	Receiver->AddReserveEntityIdsDelegate(ReserveRequestID, CacheEntityIDsDelegate);
@@ -109,15 +146,16 @@ void UEntityPool::OnEntityRangeExpired(uint32 ExpiringEntityRangeId)
 	{
 		// This is not the most recent entity range, just clean up without requesting additional IDs.
 		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Newer range detected, cleaning up Entity range ID: %d without new request"), ExpiringEntityRangeId);
+		NumRemainingEntityIds -= GetNumRemainingEntityIdsInRange(ReservedEntityIDRanges[FoundEntityRangeIndex]);
 		ReservedEntityIDRanges.RemoveAt(FoundEntityRangeIndex);
 	}
 	else
 	{
 		// Reserve then cleanup
-		if (!bIsAwaitingResponse)
+		if (NumPendingRequests == 0)
 		{
 			UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Reserving new Entity range to replace Entity range ID: %d"), ExpiringEntityRangeId);
-			ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolRefreshCount);
+			ReserveEntityIDs(FMath::Max(GetDefault<USpatialGDKSettings>()->EntityPoolRefreshCount, GetExpectedConsumptionDuringReservation()));
 		}
 		// Mark this entity range as expired, so it gets cleaned up when we receive a new entity range from Spatial.
 		ReservedEntityIDRanges[FoundEntityRangeIndex].bExpired = true;
@@ -128,32 +166,75 @@ Worker_EntityId UEntityPool::GetNextEntityId()
 {
 	if (ReservedEntityIDRanges.Num() == 0)
 	{
+		NumStarvedAllocations++;
+
 		// TODO: Improve error message
 		UE_LOG(LogSpatialEntityPool, Warning, TEXT("Tried to pop an entity ID from the pool when there were no entity IDs. Try altering your Entity Pool configuration"));
+
+		RecordConsumption();
+		ReserveEntityIDsIfNeeded();
 		return SpatialConstants::INVALID_ENTITY_ID;
 	}
 
 	EntityRange& CurrentEntityRange = ReservedEntityIDRanges[0];
 	Worker_EntityId NextId = CurrentEntityRange.CurrentEntityId++;
+	NumRemainingEntityIds--;
 
-	uint32_t TotalRemainingEntityIds = 0;
-	for (EntityRange Range : ReservedEntityIDRanges)
+	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Popped ID, %u IDs remaining"), NumRemainingEntityIds);
+
+	if (CurrentEntityRange.CurrentEntityId > CurrentEntityRange.LastEntityId)
 	{
-		TotalRemainingEntityIds += Range.LastEntityId - Range.CurrentEntityId + 1;
+		ReservedEntityIDRanges.RemoveAt(0);
 	}
 
-	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Popped ID, %i IDs remaining"), TotalRemainingEntityIds);
+	RecordConsumption();
+	ReserveEntityIDsIfNeeded();
 
-	if (TotalRemainingEntityIds < GetDefault<USpatialGDKSettings>()->EntityPoolRefreshThreshold && !bIsAwaitingResponse)
+	return NextId;
+}
+
+void UEntityPool::RecordConsumption()
+{
+	NumConsumedSinceSample++;
+
+	const double Now = FPlatformTime::Seconds();
+	const double SampleSeconds = Now - ConsumptionSampleStartTime;
+	if (SampleSeconds < SpatialConstants::ENTITY_POOL_CONSUMPTION_SAMPLE_INTERVAL_SECONDS)
 	{
-		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Pool under threshold, reserving more entity IDs"));
-		ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolRefreshCount);
+		return;
 	}
 
-	if (CurrentEntityRange.CurrentEntityId > CurrentEntityRange.LastEntityId)
+	// Time without any allocations counts towards the sample, so the rate decays once spawning calms down.
+	ConsumptionRate = FMath::Lerp(ConsumptionRate, NumConsumedSinceSample / SampleSeconds, ENTITY_POOL_SMOOTHING_FACTOR);
+	ConsumptionSampleStartTime = Now;
+	NumConsumedSinceSample = 0;
+}
+
+uint32 UEntityPool::GetExpectedConsumptionDuringReservation() const
+{
+	return static_cast<uint32>(FMath::CeilToDouble(ConsumptionRate * ReservationRoundTripSeconds * ENTITY_POOL_ROUND_TRIPS_OF_HEADROOM));
+}
+
+void UEntityPool::ReserveEntityIDsIfNeeded()
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	if (NumPendingRequests >= SpatialGDKSettings->EntityPoolMaxPendingRequests)
 	{
-		ReservedEntityIDRanges.RemoveAt(0);
+		return;
 	}
 
-	return NextId;
+	// The refresh threshold and count are lower bounds. When entity IDs are being used faster than a reservation
+	// request can replenish them, reserve enough to cover the IDs expected to be used while requests are in flight.
+	const uint32 ExpectedConsumption = GetExpectedConsumptionDuringReservation();
+	const uint32 RefreshThreshold = FMath::Max(SpatialGDKSettings->EntityPoolRefreshThreshold, ExpectedConsumption);
+
+	if (NumRemainingEntityIds + NumPendingEntityIds >= RefreshThreshold)
+	{
+		return;
+	}
+
+	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Pool under threshold (%u IDs remaining, %u pending, %.1f IDs used per second), reserving more entity IDs"),
+		NumRemainingEntityIds, NumPendingEntityIds, ConsumptionRate);
+	ReserveEntityIDs(FMath::Max(SpatialGDKSettings->EntityPoolRefreshCount, ExpectedConsumption));
 }
@@ -0,0 +1,82 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HandoverShadowArena.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+
+FHandoverShadowArena::FHandoverShadowArena(const FClassInfo& InClassInfo)
+	// Keep every slot aligned so properties keep the alignment they were laid out with.
+	: SlotSize(Align(FMath::Max(InClassInfo.HandoverShadowDataSize, 1), 16))
+{
+	for (const FHandoverShadowSpan& Span : InClassInfo.HandoverShadowSpans)
+	{
+		const FHandoverPropertyInfo& PropertyInfo = InClassInfo.HandoverProperties[Span.FirstProperty];
+		if (!Span.bMemoryComparable && PropertyInfo.ArrayIdx == 0)
+		{
+			ComplexProperties.Add(PropertyInfo.Property);
+			ComplexPropertyShadowOffsets.Add(PropertyInfo.ShadowOffset);
+		}
+	}
+}
+
+FHandoverShadowArena::~FHandoverShadowArena()
+{
+	for (TConstSetBitIterator<> It(AllocatedSlots); It; ++It)
+	{
+		DestroySlot(GetData(It.GetIndex()));
+	}
+
+	for (uint8* Chunk : Chunks)
+	{
+		FMemory::Free(Chunk);
+	}
+}
+
+int32 FHandoverShadowArena::Allocate()
+{
+	if (FreeSlots.Num() == 0)
+	{
+		const int32 FirstSlot = Chunks.Num() * SlotsPerChunk;
+		Chunks.Add(static_cast<uint8*>(FMemory::Malloc(SlotSize * SlotsPerChunk, 16)));
+		AllocatedSlots.Add(false, SlotsPerChunk);
+
+		// Hand out slots in ascending order, so objects allocated together are next to each other.
+		for (int32 Slot = FirstSlot + SlotsPerChunk - 1; Slot >= FirstSlot; Slot--)
+		{
+			FreeSlots.Add(Slot);
+		}
+	}
+
+	const int32 Slot = FreeSlots.Pop(false);
+	AllocatedSlots[Slot] = true;
+	InitializeSlot(GetData(Slot));
+
+	return Slot;
+}
+
+void FHandoverShadowArena::Free(int32 Slot)
+{
+	check(AllocatedSlots.IsValidIndex(Slot) && AllocatedSlots[Slot]);
+
+	DestroySlot(GetData(Slot));
+	AllocatedSlots[Slot] = false;
+	FreeSlots.Add(Slot);
+}
+
+void FHandoverShadowArena::InitializeSlot(uint8* Data) const
+{
+	FMemory::Memzero(Data, SlotSize);
+
+	for (int32 i = 0; i < ComplexProperties.Num(); i++)
+	{
+		ComplexProperties[i]->InitializeValue(Data + ComplexPropertyShadowOffsets[i]);
+	}
+}
+
+void FHandoverShadowArena::DestroySlot(uint8* Data) const
+{
+	for (int32 i = 0; i < ComplexProperties.Num(); i++)
+	{
+		ComplexProperties[i]->DestroyValue(Data + ComplexPropertyShadowOffsets[i]);
+	}
+}
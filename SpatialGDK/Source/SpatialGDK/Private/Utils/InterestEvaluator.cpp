@@ -0,0 +1,262 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/InterestEvaluator.h"
+
+DEFINE_LOG_CATEGORY(LogInterestEvaluator);
+
+namespace
+{
+using namespace SpatialGDK;
+
+double GetDistanceSquared(const Coordinates& A, const Coordinates& B)
+{
+	const double DX = A.X - B.X;
+	const double DY = A.Y - B.Y;
+	const double DZ = A.Z - B.Z;
+	return DX * DX + DY * DY + DZ * DZ;
+}
+
+bool IsInSphere(const Coordinates& Position, const Coordinates& Center, double Radius)
+{
+	return GetDistanceSquared(Position, Center) <= Radius * Radius;
+}
+
+bool IsInCylinder(const Coordinates& Position, const Coordinates& Center, double Radius)
+{
+	// Cylinders are infinitely tall along the Y axis.
+	const double DX = Position.X - Center.X;
+	const double DZ = Position.Z - Center.Z;
+	return DX * DX + DZ * DZ <= Radius * Radius;
+}
+
+bool IsInBox(const Coordinates& Position, const Coordinates& Center, const EdgeLength& Edges)
+{
+	return FMath::Abs(Position.X - Center.X) <= Edges.X * 0.5
+		&& FMath::Abs(Position.Y - Center.Y) <= Edges.Y * 0.5
+		&& FMath::Abs(Position.Z - Center.Z) <= Edges.Z * 0.5;
+}
+
+// The frequency an entity component is delivered at, given the frequencies of the queries it matched.
+// An unset frequency means updates are delivered as soon as possible, which wins over any limit.
+struct FMatchedFrequency
+{
+	bool bUnlimited = false;
+	float MaxFrequency = 0.0f;
+
+	void Add(const TSchemaOption<float>& Frequency)
+	{
+		if (Frequency.IsSet())
+		{
+			MaxFrequency = FMath::Max(MaxFrequency, *Frequency);
+		}
+		else
+		{
+			bUnlimited = true;
+		}
+	}
+
+	float Apply(float UpdatesPerSecond) const
+	{
+		return bUnlimited ? UpdatesPerSecond : FMath::Min(UpdatesPerSecond, MaxFrequency);
+	}
+};
+}
+
+namespace SpatialGDK
+{
+
+int32 InterestEvaluationResult::GetNumComponents() const
+{
+	int32 NumComponents = 0;
+	for (const auto& EntityComponentsPair : EntityComponents)
+	{
+		NumComponents += EntityComponentsPair.Value.Num();
+	}
+	return NumComponents;
+}
+
+void InterestEvaluator::AddEntity(Worker_EntityId EntityId, const EvaluatedEntity& Entity)
+{
+	Entities.Add(EntityId, Entity);
+}
+
+void InterestEvaluator::RemoveEntity(Worker_EntityId EntityId)
+{
+	Entities.Remove(EntityId);
+}
+
+void InterestEvaluator::Reset()
+{
+	Entities.Empty();
+}
+
+const EvaluatedEntity* InterestEvaluator::GetEntity(Worker_EntityId EntityId) const
+{
+	return Entities.Find(EntityId);
+}
+
+bool InterestEvaluator::Matches(const QueryConstraint& Constraint, Worker_EntityId EntityId, const Coordinates& RelativeTo) const
+{
+	const EvaluatedEntity* Entity = Entities.Find(EntityId);
+	return Entity != nullptr && Matches(Constraint, EntityId, *Entity, RelativeTo);
+}
+
+bool InterestEvaluator::Matches(const QueryConstraint& Constraint, Worker_EntityId EntityId, const EvaluatedEntity& Entity, const Coordinates& RelativeTo) const
+{
+	if (!Constraint.IsValid())
+	{
+		return false;
+	}
+
+	// The runtime expects exactly one of these to be set, but any that are set must all match.
+	if (Constraint.SphereConstraint.IsSet() && !IsInSphere(Entity.Position, Constraint.SphereConstraint->Center, Constraint.SphereConstraint->Radius))
+	{
+		return false;
+	}
+
+	if (Constraint.CylinderConstraint.IsSet() && !IsInCylinder(Entity.Position, Constraint.CylinderConstraint->Center, Constraint.CylinderConstraint->Radius))
+	{
+		return false;
+	}
+
+	if (Constraint.BoxConstraint.IsSet() && !IsInBox(Entity.Position, Constraint.BoxConstraint->Center, Constraint.BoxConstraint->EdgeLength))
+	{
+		return false;
+	}
+
+	if (Constraint.RelativeSphereConstraint.IsSet() && !IsInSphere(Entity.Position, RelativeTo, Constraint.RelativeSphereConstraint->Radius))
+	{
+		return false;
+	}
+
+	if (Constraint.RelativeCylinderConstraint.IsSet() && !IsInCylinder(Entity.Position, RelativeTo, Constraint.RelativeCylinderConstraint->Radius))
+	{
+		return false;
+	}
+
+	if (Constraint.RelativeBoxConstraint.IsSet() && !IsInBox(Entity.Position, RelativeTo, Constraint.RelativeBoxConstraint->EdgeLength))
+	{
+		return false;
+	}
+
+	if (Constraint.EntityIdConstraint.IsSet() && *Constraint.EntityIdConstraint != EntityId)
+	{
+		return false;
+	}
+
+	if (Constraint.ComponentConstraint.IsSet() && !Entity.Components.Contains(*Constraint.ComponentConstraint))
+	{
+		return false;
+	}
+
+	for (const QueryConstraint& AndConstraintEntry : Constraint.AndConstraint)
+	{
+		if (!Matches(AndConstraintEntry, EntityId, Entity, RelativeTo))
+		{
+			return false;
+		}
+	}
+
+	if (Constraint.OrConstraint.Num() > 0)
+	{
+		bool bMatchedAny = false;
+		for (const QueryConstraint& OrConstraintEntry : Constraint.OrConstraint)
+		{
+			if (Matches(OrConstraintEntry, EntityId, Entity, RelativeTo))
+			{
+				bMatchedAny = true;
+				break;
+			}
+		}
+
+		if (!bMatchedAny)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+InterestEvaluationResult InterestEvaluator::Evaluate(Worker_EntityId InterestEntityId, const Interest& InterestComponent, const TSet<Worker_ComponentId>& AuthoritativeComponentIds) const
+{
+	TArray<Query> Queries;
+	for (const auto& ComponentInterestPair : InterestComponent.ComponentInterestMap)
+	{
+		if (AuthoritativeComponentIds.Contains(ComponentInterestPair.Key))
+		{
+			Queries.Append(ComponentInterestPair.Value.Queries);
+		}
+	}
+
+	return Evaluate(InterestEntityId, Queries);
+}
+
+InterestEvaluationResult InterestEvaluator::Evaluate(Worker_EntityId InterestEntityId, const TArray<Query>& Queries) const
+{
+	InterestEvaluationResult Result;
+	Evaluate(InterestEntityId, Queries, Result);
+	return Result;
+}
+
+void InterestEvaluator::Evaluate(Worker_EntityId InterestEntityId, const TArray<Query>& Queries, InterestEvaluationResult& OutResult) const
+{
+	const EvaluatedEntity* InterestEntity = Entities.Find(InterestEntityId);
+	if (InterestEntity == nullptr)
+	{
+		UE_LOG(LogInterestEvaluator, Warning, TEXT("Evaluating interest for entity %lld which isn't in the evaluator. Relative constraints will be centered on the origin."), InterestEntityId);
+	}
+	const Coordinates RelativeTo = InterestEntity != nullptr ? InterestEntity->Position : Origin;
+
+	// Frequencies are tracked across every query before estimating bytes, as overlapping queries don't add up.
+	TMap<TPair<Worker_EntityId_Key, Worker_ComponentId>, FMatchedFrequency> MatchedFrequencies;
+
+	for (const auto& EntityPair : Entities)
+	{
+		const Worker_EntityId EntityId = EntityPair.Key;
+		const EvaluatedEntity& Entity = EntityPair.Value;
+
+		for (const Query& QueryEntry : Queries)
+		{
+			if (!Matches(QueryEntry.Constraint, EntityId, Entity, RelativeTo))
+			{
+				continue;
+			}
+
+			const bool bFullSnapshot = QueryEntry.FullSnapshotResult.IsSet() && *QueryEntry.FullSnapshotResult;
+
+			for (const auto& ComponentPair : Entity.Components)
+			{
+				if (!bFullSnapshot && !QueryEntry.ResultComponentId.Contains(ComponentPair.Key))
+				{
+					continue;
+				}
+
+				MatchedFrequencies.FindOrAdd(MakeTuple(static_cast<Worker_EntityId_Key>(EntityId), ComponentPair.Key)).Add(QueryEntry.Frequency);
+			}
+		}
+	}
+
+	for (const auto& MatchedPair : MatchedFrequencies)
+	{
+		const Worker_EntityId_Key EntityId = MatchedPair.Key.Key;
+		const Worker_ComponentId ComponentId = MatchedPair.Key.Value;
+
+		OutResult.EntityComponents.FindOrAdd(EntityId).Add(ComponentId);
+
+		// A component already in the result from an earlier evaluation is only received more often if these queries raise its rate.
+		const EvaluatedComponent& Component = Entities[EntityId].Components[ComponentId];
+		float& UpdatesPerSecond = OutResult.ComponentUpdatesPerSecond.FindOrAdd(MatchedPair.Key);
+		const float NewUpdatesPerSecond = FMath::Max(UpdatesPerSecond, MatchedPair.Value.Apply(Component.UpdatesPerSecond));
+		OutResult.EstimatedBytesPerSecond += Component.BytesPerUpdate * (NewUpdatesPerSecond - UpdatesPerSecond);
+		UpdatesPerSecond = NewUpdatesPerSecond;
+	}
+}
+
+void InterestEvaluator::LogResult(const InterestEvaluationResult& Result, const TCHAR* Description)
+{
+	UE_LOG(LogInterestEvaluator, Log, TEXT("%s: %d entities, %d components, estimated %.1f bytes per second."),
+		Description, Result.EntityComponents.Num(), Result.GetNumComponents(), Result.EstimatedBytesPerSecond);
+}
+
+} // namespace SpatialGDK
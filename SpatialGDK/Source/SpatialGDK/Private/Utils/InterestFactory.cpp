@@ -5,7 +5,6 @@
 #include "Engine/World.h"
 #include "Engine/Classes/GameFramework/Actor.h"
 #include "GameFramework/PlayerController.h"
-#include "UObject/UObjectIterator.h"
 
 #include "EngineClasses/Components/ActorInterestComponent.h"
 #include "EngineClasses/SpatialNetConnection.h"
@@ -13,90 +12,12 @@
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "SpatialGDKSettings.h"
 #include "SpatialConstants.h"
-#include "UObject/UObjectIterator.h"
+#include "Utils/SchemaDatabase.h"
 
 DEFINE_LOG_CATEGORY(LogInterestFactory);
 
-namespace
-{
-static TMap<UClass*, float> ClientInterestDistancesSquared;
-}
-
 namespace SpatialGDK
 {
-void GatherClientInterestDistances()
-{
-	ClientInterestDistancesSquared.Empty();
-
-	const AActor* DefaultActor = Cast<AActor>(AActor::StaticClass()->GetDefaultObject());
-	const float DefaultDistanceSquared = DefaultActor->NetCullDistanceSquared;
-	const float MaxDistanceSquared = GetDefault<USpatialGDKSettings>()->MaxNetCullDistanceSquared;
-
-	// Gather ClientInterestDistance settings, and add any larger than the default radius to a list for processing.
-	TMap<UClass*, float> DiscoveredInterestDistancesSquared;
-	for (TObjectIterator<UClass> It; It; ++It)
-	{
-		if (It->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly | SPATIALCLASS_NotSpatialType))
-		{
-			continue;
-		}
-		if (It->HasAnyClassFlags(CLASS_NewerVersionExists))
-		{
-			// This skips classes generated for hot reload etc (i.e. REINST_, SKEL_, TRASHCLASS_)
-			continue;
-		}
-		if (!It->IsChildOf<AActor>())
-		{
-			continue;
-		}
-
-		const AActor* IteratedDefaultActor = Cast<AActor>(It->GetDefaultObject());
-		if (IteratedDefaultActor->NetCullDistanceSquared > DefaultDistanceSquared)
-		{
-			float ActorNetCullDistanceSquared = IteratedDefaultActor->NetCullDistanceSquared;
-
-			if (MaxDistanceSquared != 0.f && IteratedDefaultActor->NetCullDistanceSquared > MaxDistanceSquared)
-			{
-				UE_LOG(LogInterestFactory, Warning, TEXT("NetCullDistanceSquared for %s too large, clamping from %f to %f"),
-					*It->GetName(), ActorNetCullDistanceSquared, MaxDistanceSquared);
-
-				ActorNetCullDistanceSquared = MaxDistanceSquared;
-			}
-
-			DiscoveredInterestDistancesSquared.Add(*It, ActorNetCullDistanceSquared);
-		}
-	}
-
-	// Sort the map for iteration so that parent classes are seen before derived classes. This lets us skip
-	// derived classes that have a smaller interest distance than a parent class.
-	DiscoveredInterestDistancesSquared.KeySort([](const UClass& LHS, const UClass& RHS) {
-		return
-			LHS.IsChildOf(&RHS) ? -1 :
-			RHS.IsChildOf(&LHS) ? 1 :
-			0;
-	});
-
-	// If an actor's interest distance is smaller than that of a parent class, there's no need to add interest for that actor.
-	// Can't do inline removal since the sorted order is only guaranteed when the map isn't changed.
-	for (const auto& ActorInterestDistance : DiscoveredInterestDistancesSquared)
-	{
-		bool bShouldAdd = true;
-		for (auto& OptimizedInterestDistance : ClientInterestDistancesSquared)
-		{
-			if (ActorInterestDistance.Key->IsChildOf(OptimizedInterestDistance.Key) && ActorInterestDistance.Value <= OptimizedInterestDistance.Value)
-			{
-				// No need to add this interest distance since it's captured in the optimized map already.
-				bShouldAdd = false;
-				break;
-			}
-		}
-		if (bShouldAdd)
-		{
-			ClientInterestDistancesSquared.Add(ActorInterestDistance.Key, ActorInterestDistance.Value);
-		}
-	}
-}
-
 InterestFactory::InterestFactory(AActor* InActor, const FClassInfo& InInfo, USpatialNetDriver* InNetDriver)
 	: Actor(InActor)
 	, Info(InInfo)
@@ -105,14 +26,26 @@ InterestFactory::InterestFactory(AActor* InActor, const FClassInfo& InInfo, USpa
 {
 }
 
-Worker_ComponentData InterestFactory::CreateInterestData() const
+Worker_ComponentData InterestFactory::CreateInterestData(LastSentInterest& OutSentInterest) const
 {
-	return CreateInterest().CreateInterestData();
+	Interest NewInterest = CreateInterest();
+	OutSentInterest.Set(NewInterest.GetDigest());
+	return NewInterest.CreateInterestData();
 }
 
-Worker_ComponentUpdate InterestFactory::CreateInterestUpdate() const
+bool InterestFactory::CreateInterestUpdate(LastSentInterest& InOutSentInterest, Worker_ComponentUpdate& OutUpdate) const
 {
-	return CreateInterest().CreateInterestUpdate();
+	Interest NewInterest = CreateInterest();
+
+	const FSHAHash NewInterestDigest = NewInterest.GetDigest();
+	if (InOutSentInterest.Matches(NewInterestDigest))
+	{
+		return false;
+	}
+
+	InOutSentInterest.Set(NewInterestDigest);
+	OutUpdate = NewInterest.CreateInterestUpdate();
+	return true;
 }
 
 Interest InterestFactory::CreateInterest() const
@@ -150,7 +83,7 @@ Interest InterestFactory::CreateActorInterest() const
 {
 	Interest NewInterest;
 
-	QueryConstraint SystemConstraints = CreateSystemDefinedConstraints();
+	QueryConstraint SystemConstraints = CreateSystemDefinedConstraints(true);
 
 	if (!SystemConstraints.IsValid())
 	{
@@ -174,7 +107,7 @@ Interest InterestFactory::CreateActorInterest() const
 
 Interest InterestFactory::CreatePlayerOwnedActorInterest() const
 {
-	QueryConstraint SystemConstraints = CreateSystemDefinedConstraints();
+	QueryConstraint SystemConstraints = CreateSystemDefinedConstraints(true);
 
 	// Servers only need the defined constraints
 	Query ServerQuery;
@@ -187,11 +120,15 @@ Interest InterestFactory::CreatePlayerOwnedActorInterest() const
 	// Clients should only check out entities that are in loaded sublevels
 	QueryConstraint LevelConstraints = CreateLevelConstraints();
 
+	// With client interest bands, the default checkout radius is replaced by a query per band.
+	const bool bUseClientInterestBands = GetDefault<USpatialGDKSettings>()->ClientInterestBands.Num() > 0;
+	QueryConstraint ClientSystemConstraints = bUseClientInterestBands ? CreateSystemDefinedConstraints(false) : SystemConstraints;
+
 	QueryConstraint ClientConstraint;
 
-	if (SystemConstraints.IsValid())
+	if (ClientSystemConstraints.IsValid())
 	{
-		ClientConstraint.AndConstraint.Add(SystemConstraints);
+		ClientConstraint.AndConstraint.Add(ClientSystemConstraints);
 	}
 
 	if (LevelConstraints.IsValid())
@@ -206,6 +143,11 @@ Interest InterestFactory::CreatePlayerOwnedActorInterest() const
 	ComponentInterest ClientComponentInterest;
 	ClientComponentInterest.Queries.Add(ClientQuery);
 
+	if (bUseClientInterestBands)
+	{
+		AddClientInterestBandQueries(LevelConstraints, ClientComponentInterest.Queries);
+	}
+
 	AddUserDefinedQueries(LevelConstraints, ClientComponentInterest.Queries);
 
 	Interest NewInterest;
@@ -240,9 +182,98 @@ void InterestFactory::AddUserDefinedQueries(const QueryConstraint& LevelConstrai
 	}
 }
 
-QueryConstraint InterestFactory::CreateSystemDefinedConstraints() const
+void InterestFactory::AddClientInterestBandQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const
+{
+	if (!ShouldUseNetCullDistanceForCheckoutRadius())
+	{
+		return;
+	}
+
+	for (const FClientInterestBand& Band : GetDefault<USpatialGDKSettings>()->ClientInterestBands)
+	{
+		QueryConstraint ActorTypeConstraint;
+		if (!CreateClientInterestBandTypeConstraint(Band, ActorTypeConstraint))
+		{
+			continue;
+		}
+
+		OutQueries.Add(CreateClientInterestBandQuery(Band, ActorTypeConstraint, LevelConstraints));
+	}
+}
+
+Query InterestFactory::CreateClientInterestBandQuery(const FClientInterestBand& Band, const QueryConstraint& ActorTypeConstraint, const QueryConstraint& LevelConstraints)
 {
-	QueryConstraint CheckoutRadiusConstraint = CreateCheckoutRadiusConstraints();
+	// Components needed to spawn and position the Actors in bands which don't receive every component.
+	static const Worker_ComponentId BandBaseResultComponentIds[] = {
+		SpatialConstants::POSITION_COMPONENT_ID,
+		SpatialConstants::SPAWN_DATA_COMPONENT_ID,
+		SpatialConstants::UNREAL_METADATA_COMPONENT_ID
+	};
+
+	QueryConstraint RadiusConstraint;
+	RadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ Band.Radius / 100.0f };
+
+	Query BandQuery;
+	if (ActorTypeConstraint.IsValid() || LevelConstraints.IsValid())
+	{
+		BandQuery.Constraint.AndConstraint.Add(RadiusConstraint);
+		if (ActorTypeConstraint.IsValid())
+		{
+			BandQuery.Constraint.AndConstraint.Add(ActorTypeConstraint);
+		}
+		if (LevelConstraints.IsValid())
+		{
+			BandQuery.Constraint.AndConstraint.Add(LevelConstraints);
+		}
+	}
+	else
+	{
+		BandQuery.Constraint = RadiusConstraint;
+	}
+
+	if (Band.bFullSnapshot)
+	{
+		BandQuery.FullSnapshotResult = true;
+	}
+	else
+	{
+		BandQuery.ResultComponentId.Append(BandBaseResultComponentIds, ARRAY_COUNT(BandBaseResultComponentIds));
+		for (uint32 ComponentId : Band.ResultComponentIds)
+		{
+			BandQuery.ResultComponentId.AddUnique(ComponentId);
+		}
+	}
+
+	if (Band.MaxFrequency > 0.0f)
+	{
+		BandQuery.Frequency = Band.MaxFrequency;
+	}
+
+	return BandQuery;
+}
+
+bool InterestFactory::CreateClientInterestBandTypeConstraint(const FClientInterestBand& Band, QueryConstraint& OutActorTypeConstraint) const
+{
+	if (Band.ActorClass == nullptr)
+	{
+		return true;
+	}
+
+	// Like the per-class NetCullDistanceSquared constraints, bands for a class match the components of the class and its derived classes.
+	AddTypeHierarchyToConstraint(*Band.ActorClass, OutActorTypeConstraint);
+	if (!OutActorTypeConstraint.IsValid())
+	{
+		UE_LOG(LogInterestFactory, Warning, TEXT("Skipping client interest band for %s, as neither it nor its derived classes have schema. Have you generated schema?"),
+			*Band.ActorClass->GetName());
+		return false;
+	}
+
+	return true;
+}
+
+QueryConstraint InterestFactory::CreateSystemDefinedConstraints(bool bIncludeDefaultCheckoutRadius) const
+{
+	QueryConstraint CheckoutRadiusConstraint = CreateCheckoutRadiusConstraints(bIncludeDefaultCheckoutRadius);
 	QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint();
 	QueryConstraint AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
 
@@ -266,21 +297,13 @@ QueryConstraint InterestFactory::CreateSystemDefinedConstraints() const
 	return SystemDefinedConstraints;
 }
 
-QueryConstraint InterestFactory::CreateCheckoutRadiusConstraints() const
+QueryConstraint InterestFactory::CreateCheckoutRadiusConstraints(bool bIncludeDefaultRadius) const
 {
 	// If the actor has a component to specify interest and that indicates that we shouldn't generate
-	// constraints based on NetCullDistanceSquared, abort. There is a check elsewhere to ensure that
-	// there is at most one ActorInterestQueryComponent.
-	TArray<UActorInterestComponent*> ActorInterestComponents;
-	Actor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
-	if (ActorInterestComponents.Num() == 1)
+	// constraints based on NetCullDistanceSquared, abort.
+	if (!ShouldUseNetCullDistanceForCheckoutRadius())
 	{
-		const UActorInterestComponent* ActorInterest = ActorInterestComponents[0];
-		check(ActorInterest);
-		if (!ActorInterest->bUseNetCullDistanceSquaredForCheckoutRadius)
-		{
-			return QueryConstraint{};
-		}
+		return QueryConstraint{};
 	}
 
 	// Checkout Radius constraints are defined by the NetCullDistanceSquared property on actors.
@@ -292,40 +315,94 @@ QueryConstraint InterestFactory::CreateCheckoutRadiusConstraints() const
 	//   - Other than the default from AActor, all radius constraints also include Component constraints to
 	//     capture specific types, including all derived types of that actor.
 
-	const AActor* DefaultActor = Cast<AActor>(AActor::StaticClass()->GetDefaultObject());
-	const float DefaultDistanceSquared = DefaultActor->NetCullDistanceSquared;
+	//   - If client interest bands are configured, the largest radius of the bands without an ActorClass replaces the default
+	//     radius for servers, bands with an ActorClass add a constraint for that class like the ones below, and clients get the
+	//     bands as separate queries instead (see AddClientInterestBandQueries).
 
 	QueryConstraint CheckoutRadiusConstraints;
 
-	// Use AActor's ClientInterestDistance for the default radius (all actors in that radius will be checked out)
-	const float DefaultCheckoutRadiusMeters = FMath::Sqrt(DefaultDistanceSquared / (100.0f * 100.0f));
-	QueryConstraint DefaultCheckoutRadiusConstraint;
-	DefaultCheckoutRadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ DefaultCheckoutRadiusMeters };
-	CheckoutRadiusConstraints.OrConstraint.Add(DefaultCheckoutRadiusConstraint);
+	if (bIncludeDefaultRadius)
+	{
+		// Use AActor's ClientInterestDistance for the default radius (all actors in that radius will be checked out)
+		const AActor* DefaultActor = Cast<AActor>(AActor::StaticClass()->GetDefaultObject());
+		float DefaultCheckoutRadiusMeters = FMath::Sqrt(DefaultActor->NetCullDistanceSquared / (100.0f * 100.0f));
+
+		const TArray<FClientInterestBand>& ClientInterestBands = GetDefault<USpatialGDKSettings>()->ClientInterestBands;
+		if (ClientInterestBands.Num() > 0)
+		{
+			DefaultCheckoutRadiusMeters = 0.0f;
+			for (const FClientInterestBand& Band : ClientInterestBands)
+			{
+				if (Band.ActorClass == nullptr)
+				{
+					DefaultCheckoutRadiusMeters = FMath::Max(DefaultCheckoutRadiusMeters, Band.Radius / 100.0f);
+					continue;
+				}
+
+				// Bands for a class only cover that class' Actors, so servers get a constraint with the band's radius for the class instead.
+				QueryConstraint ActorTypeConstraint;
+				if (CreateClientInterestBandTypeConstraint(Band, ActorTypeConstraint))
+				{
+					QueryConstraint BandRadiusConstraint;
+					BandRadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ Band.Radius / 100.0f };
+
+					QueryConstraint BandConstraint;
+					BandConstraint.AndConstraint.Add(BandRadiusConstraint);
+					BandConstraint.AndConstraint.Add(ActorTypeConstraint);
+					CheckoutRadiusConstraints.OrConstraint.Add(BandConstraint);
+				}
+			}
+		}
+
+		if (DefaultCheckoutRadiusMeters > 0.0f)
+		{
+			QueryConstraint DefaultCheckoutRadiusConstraint;
+			DefaultCheckoutRadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ DefaultCheckoutRadiusMeters };
+			CheckoutRadiusConstraints.OrConstraint.Add(DefaultCheckoutRadiusConstraint);
+		}
+	}
 
 	// For every interest distance that we still want, add a constraint with the distance for the actor type and all of its derived types.
-	for (const auto& InterestDistanceSquared: ClientInterestDistancesSquared)
+	// These are shared by every Actor, and only rebuilt after the client interest distances change.
+	check(NetDriver && NetDriver->ClassInfoManager);
+	CheckoutRadiusConstraints.OrConstraint.Append(NetDriver->ClassInfoManager->GetClientInterestDistances().GetClassConstraints(
+		[this](UClass* Class, float DistanceSquared, QueryConstraint& OutCheckoutRadiusConstraint)
 	{
-		QueryConstraint CheckoutRadiusConstraint;
-
 		QueryConstraint RadiusConstraint;
-		const float CheckoutRadiusMeters = FMath::Sqrt(InterestDistanceSquared.Value / (100.0f * 100.0f));
+		const float CheckoutRadiusMeters = FMath::Sqrt(DistanceSquared / (100.0f * 100.0f));
 		RadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ CheckoutRadiusMeters };
-		CheckoutRadiusConstraint.AndConstraint.Add(RadiusConstraint);
 
 		QueryConstraint ActorTypeConstraint;
-		check(InterestDistanceSquared.Key);
-		AddTypeHierarchyToConstraint(*InterestDistanceSquared.Key, ActorTypeConstraint);
-		if (ActorTypeConstraint.IsValid())
+		check(Class);
+		AddTypeHierarchyToConstraint(*Class, ActorTypeConstraint);
+		if (!ActorTypeConstraint.IsValid())
 		{
-			CheckoutRadiusConstraint.AndConstraint.Add(ActorTypeConstraint);
-			CheckoutRadiusConstraints.OrConstraint.Add(CheckoutRadiusConstraint);
+			return false;
 		}
-	}
+
+		OutCheckoutRadiusConstraint.AndConstraint.Add(RadiusConstraint);
+		OutCheckoutRadiusConstraint.AndConstraint.Add(ActorTypeConstraint);
+		return true;
+	}));
 
 	return CheckoutRadiusConstraints;
 }
 
+bool InterestFactory::ShouldUseNetCullDistanceForCheckoutRadius() const
+{
+	// There is a check elsewhere to ensure that there is at most one ActorInterestQueryComponent.
+	TArray<UActorInterestComponent*> ActorInterestComponents;
+	Actor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
+	if (ActorInterestComponents.Num() == 1)
+	{
+		const UActorInterestComponent* ActorInterest = ActorInterestComponents[0];
+		check(ActorInterest);
+		return ActorInterest->bUseNetCullDistanceSquaredForCheckoutRadius;
+	}
+
+	return true;
+}
+
 QueryConstraint InterestFactory::CreateAlwaysInterestedConstraint() const
 {
 	QueryConstraint AlwaysInterestedConstraint;
@@ -0,0 +1,159 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/LoadAwareOffloadingPolicy.h"
+
+namespace SpatialGDK
+{
+
+LoadAwareOffloadingPolicy::LoadAwareOffloadingPolicy(const TArray<LoadAwareActorGroup>& InGroups, float InHighLoad, float InLowLoad, float InMinSecondsBetweenReassignments, float InReportTimeoutSeconds)
+	: Groups(InGroups)
+	, HighLoad(InHighLoad)
+	, LowLoad(FMath::Min(InLowLoad, InHighLoad))
+	, MinSecondsBetweenReassignments(InMinSecondsBetweenReassignments)
+	, ReportTimeoutSeconds(InReportTimeoutSeconds)
+{
+}
+
+void LoadAwareOffloadingPolicy::ReportWorkerLoad(const FString& WorkerId, int32 WorkerTypeIndex, double Load, const TSet<FName>& OwnedActorGroups, double Now)
+{
+	WorkerLoadReports.Add(WorkerId, WorkerLoadReport{ WorkerTypeIndex, Load, Now, OwnedActorGroups });
+}
+
+TArray<ActorGroupReassignment> LoadAwareOffloadingPolicy::Evaluate(double Now)
+{
+	TArray<ActorGroupReassignment> Reassignments;
+
+	TMap<int32, double> WorkerTypeLoads;
+	TMap<int32, int32> WorkerTypeReportCounts;
+	TSet<FName> OwnedActorGroups;
+	for (auto It = WorkerLoadReports.CreateIterator(); It; ++It)
+	{
+		const WorkerLoadReport& Report = It.Value();
+		if (Now - Report.Time > ReportTimeoutSeconds)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		WorkerTypeLoads.FindOrAdd(Report.WorkerTypeIndex) += Report.Load;
+		WorkerTypeReportCounts.FindOrAdd(Report.WorkerTypeIndex)++;
+		OwnedActorGroups.Append(Report.OwnedActorGroups);
+	}
+
+	for (auto& WorkerTypeLoad : WorkerTypeLoads)
+	{
+		WorkerTypeLoad.Value /= WorkerTypeReportCounts[WorkerTypeLoad.Key];
+	}
+
+	// Groups with owned Actors go back home regardless of the time since the last reassignment, as their EntityACLs can't be updated meanwhile.
+	if (!TakeBackOwnedActorGroup(OwnedActorGroups, Reassignments) && Now - LastReassignmentTime >= MinSecondsBetweenReassignments)
+	{
+		TSet<int32> HomeWorkerTypeIndices;
+		for (const LoadAwareActorGroup& Group : Groups)
+		{
+			bool bAlreadyEvaluated = false;
+			HomeWorkerTypeIndices.Add(Group.HomeWorkerTypeIndex, &bAlreadyEvaluated);
+			if (!bAlreadyEvaluated && ReassignForLoad(Group.HomeWorkerTypeIndex, WorkerTypeLoads, OwnedActorGroups, Reassignments))
+			{
+				break;
+			}
+		}
+	}
+
+	for (const ActorGroupReassignment& Reassignment : Reassignments)
+	{
+		SetOffloaded(Reassignment.ActorGroup, !Groups.ContainsByPredicate([&Reassignment](const LoadAwareActorGroup& Group)
+		{
+			return Group.ActorGroup == Reassignment.ActorGroup && Group.HomeWorkerTypeIndex == Reassignment.WorkerTypeIndex;
+		}));
+		LastReassignmentTime = Now;
+	}
+
+	return Reassignments;
+}
+
+bool LoadAwareOffloadingPolicy::TakeBackOwnedActorGroup(const TSet<FName>& OwnedActorGroups, TArray<ActorGroupReassignment>& OutReassignments) const
+{
+	for (const LoadAwareActorGroup& Group : Groups)
+	{
+		if (OffloadedGroups.Contains(Group.ActorGroup) && OwnedActorGroups.Contains(Group.ActorGroup))
+		{
+			OutReassignments.Add(ActorGroupReassignment{ Group.ActorGroup, Group.HomeWorkerTypeIndex });
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool LoadAwareOffloadingPolicy::ReassignForLoad(int32 HomeWorkerTypeIndex, const TMap<int32, double>& WorkerTypeLoads, const TSet<FName>& OwnedActorGroups, TArray<ActorGroupReassignment>& OutReassignments) const
+{
+	const double* HomeLoad = WorkerTypeLoads.Find(HomeWorkerTypeIndex);
+	if (HomeLoad == nullptr)
+	{
+		return false;
+	}
+
+	if (*HomeLoad > HighLoad)
+	{
+		for (const LoadAwareActorGroup& Group : Groups)
+		{
+			if (Group.HomeWorkerTypeIndex != HomeWorkerTypeIndex || OffloadedGroups.Contains(Group.ActorGroup) || OwnedActorGroups.Contains(Group.ActorGroup))
+			{
+				continue;
+			}
+
+			const double* OffloadLoad = WorkerTypeLoads.Find(Group.OffloadWorkerTypeIndex);
+			if (OffloadLoad != nullptr && *OffloadLoad >= LowLoad)
+			{
+				continue;
+			}
+
+			OutReassignments.Add(ActorGroupReassignment{ Group.ActorGroup, Group.OffloadWorkerTypeIndex });
+			return true;
+		}
+	}
+	else if (*HomeLoad < LowLoad)
+	{
+		for (int32 Index = Groups.Num() - 1; Index >= 0; Index--)
+		{
+			const LoadAwareActorGroup& Group = Groups[Index];
+			if (Group.HomeWorkerTypeIndex != HomeWorkerTypeIndex || !OffloadedGroups.Contains(Group.ActorGroup))
+			{
+				continue;
+			}
+
+			OutReassignments.Add(ActorGroupReassignment{ Group.ActorGroup, Group.HomeWorkerTypeIndex });
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool LoadAwareOffloadingPolicy::IsOffloaded(FName ActorGroup) const
+{
+	return OffloadedGroups.Contains(ActorGroup);
+}
+
+bool LoadAwareOffloadingPolicy::IsLoadAwareActorGroup(FName ActorGroup) const
+{
+	return Groups.ContainsByPredicate([ActorGroup](const LoadAwareActorGroup& Group)
+	{
+		return Group.ActorGroup == ActorGroup;
+	});
+}
+
+void LoadAwareOffloadingPolicy::SetOffloaded(FName ActorGroup, bool bOffloaded)
+{
+	if (bOffloaded)
+	{
+		OffloadedGroups.Add(ActorGroup);
+	}
+	else
+	{
+		OffloadedGroups.Remove(ActorGroup);
+	}
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,87 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ReplicationTimingWheel.h"
+
+#include "GameFramework/Actor.h"
+
+FReplicationTimingWheel::FReplicationTimingWheel(float InSlotDuration, int32 InNumSlots)
+	: SlotDuration(InSlotDuration)
+	, CurrentTick(0)
+	, NextGeneration(0)
+{
+	check(SlotDuration > 0.0f && InNumSlots > 0);
+	Slots.SetNum(InNumSlots);
+}
+
+void FReplicationTimingWheel::Schedule(AActor* Actor, float Time)
+{
+	const uint32 Generation = NextGeneration++;
+	ActorToGeneration.Add(Actor, Generation);
+
+	const int64 Tick = FMath::Max(GetTick(Time), CurrentTick);
+	Slots[Tick % Slots.Num()].Add(FEntry{ Actor, Time, Generation });
+}
+
+void FReplicationTimingWheel::Unschedule(const AActor* Actor)
+{
+	ActorToGeneration.Remove(Actor);
+}
+
+void FReplicationTimingWheel::PopDue(float CurrentTime, TArray<AActor*>& OutDueActors)
+{
+	const int64 TargetTick = GetTick(CurrentTime);
+
+	// Visiting every slot once is enough to find all due entries, however far behind we are.
+	const int64 FirstTick = FMath::Max(CurrentTick, TargetTick - Slots.Num() + 1);
+
+	for (int64 Tick = FirstTick; Tick <= TargetTick; Tick++)
+	{
+		TArray<FEntry>& Slot = Slots[Tick % Slots.Num()];
+
+		for (int32 i = Slot.Num() - 1; i >= 0; i--)
+		{
+			const FEntry& Entry = Slot[i];
+
+			const uint32* Generation = ActorToGeneration.Find(Entry.Actor);
+			if (Generation == nullptr || *Generation != Entry.Generation)
+			{
+				// Stale entry, the Actor was rescheduled or unscheduled.
+				Slot.RemoveAtSwap(i, 1, false);
+				continue;
+			}
+
+			if (!Entry.Actor.IsValid())
+			{
+				ActorToGeneration.Remove(Entry.Actor);
+				Slot.RemoveAtSwap(i, 1, false);
+				continue;
+			}
+
+			if (Entry.Time <= CurrentTime)
+			{
+				OutDueActors.Add(Entry.Actor.Get());
+				ActorToGeneration.Remove(Entry.Actor);
+				Slot.RemoveAtSwap(i, 1, false);
+			}
+		}
+	}
+
+	// Stay on the current slot, it may still hold entries due later this tick.
+	CurrentTick = FMath::Max(CurrentTick, TargetTick);
+}
+
+void FReplicationTimingWheel::Reset()
+{
+	for (TArray<FEntry>& Slot : Slots)
+	{
+		Slot.Reset();
+	}
+
+	ActorToGeneration.Empty();
+	CurrentTick = 0;
+}
+
+int64 FReplicationTimingWheel::GetTick(float Time) const
+{
+	return FMath::Max<int64>(0, static_cast<int64>(Time / SlotDuration));
+}
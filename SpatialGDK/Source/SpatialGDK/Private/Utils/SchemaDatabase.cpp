@@ -0,0 +1,292 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SchemaDatabase.h"
+
+#include "Serialization/CustomVersion.h"
+
+namespace
+{
+struct FSchemaDatabaseCustomVersion
+{
+	enum Type
+	{
+		BeforeCustomVersionWasAdded = 0,
+		AddedCompactSchemaDatabase,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	static const FGuid GUID;
+};
+
+const FGuid FSchemaDatabaseCustomVersion::GUID(0x5C6B1E4A, 0x8F2D4A37, 0x9E1B7C40, 0x2D6F3A91);
+FCustomVersionRegistration GRegisterSchemaDatabaseCustomVersion(FSchemaDatabaseCustomVersion::GUID, FSchemaDatabaseCustomVersion::LatestVersion, TEXT("SpatialSchemaDatabaseVer"));
+
+void SerializeSchemaComponents(FArchive& Ar, uint32 (&SchemaComponents)[SCHEMA_Count])
+{
+	for (uint32& ComponentId : SchemaComponents)
+	{
+		Ar << ComponentId;
+	}
+}
+
+// The generated schema names are only used by schema generation, so they're left out of the compact schema database.
+void SerializeActorSchemaData(FArchive& Ar, FActorSchemaData& ActorSchemaData)
+{
+	SerializeSchemaComponents(Ar, ActorSchemaData.SchemaComponents);
+
+	int32 NumSubobjects = ActorSchemaData.SubobjectData.Num();
+	Ar << NumSubobjects;
+
+	if (Ar.IsLoading())
+	{
+		ActorSchemaData.SubobjectData.Empty(NumSubobjects);
+		for (int32 Index = 0; Index < NumSubobjects; Index++)
+		{
+			uint32 Offset;
+			Ar << Offset;
+
+			FActorSpecificSubobjectSchemaData& SubobjectSchemaData = ActorSchemaData.SubobjectData.Add(Offset);
+			Ar << SubobjectSchemaData.ClassPath;
+			Ar << SubobjectSchemaData.Name;
+			SerializeSchemaComponents(Ar, SubobjectSchemaData.SchemaComponents);
+		}
+	}
+	else
+	{
+		for (auto& SubobjectSchemaDataPair : ActorSchemaData.SubobjectData)
+		{
+			uint32 Offset = SubobjectSchemaDataPair.Key;
+			Ar << Offset;
+			Ar << SubobjectSchemaDataPair.Value.ClassPath;
+			Ar << SubobjectSchemaDataPair.Value.Name;
+			SerializeSchemaComponents(Ar, SubobjectSchemaDataPair.Value.SchemaComponents);
+		}
+	}
+}
+
+void SerializeSubobjectSchemaData(FArchive& Ar, FSubobjectSchemaData& SubobjectSchemaData)
+{
+	int32 NumDynamicSubobjects = SubobjectSchemaData.DynamicSubobjectComponents.Num();
+	Ar << NumDynamicSubobjects;
+
+	if (Ar.IsLoading())
+	{
+		SubobjectSchemaData.DynamicSubobjectComponents.SetNum(NumDynamicSubobjects);
+	}
+
+	for (FDynamicSubobjectSchemaData& DynamicSubobjectSchemaData : SubobjectSchemaData.DynamicSubobjectComponents)
+	{
+		SerializeSchemaComponents(Ar, DynamicSubobjectSchemaData.SchemaComponents);
+	}
+}
+
+template <typename ElementType, typename Func>
+void SerializeArray(FArchive& Ar, TArray<ElementType>& Array, Func&& SerializeElement)
+{
+	int32 Num = Array.Num();
+	Ar << Num;
+
+	if (Ar.IsLoading())
+	{
+		Array.Empty(Num);
+		Array.SetNum(Num);
+	}
+
+	for (ElementType& Element : Array)
+	{
+		SerializeElement(Ar, Element);
+	}
+}
+
+// Returns the index of Value in the sorted Array, or INDEX_NONE.
+template <typename ElementType>
+int32 BinarySearch(const TArray<ElementType>& Array, const ElementType& Value)
+{
+	int32 Low = 0;
+	int32 High = Array.Num();
+	while (Low < High)
+	{
+		const int32 Middle = Low + (High - Low) / 2;
+		if (Array[Middle] < Value)
+		{
+			Low = Middle + 1;
+		}
+		else
+		{
+			High = Middle;
+		}
+	}
+
+	return Low < Array.Num() && !(Value < Array[Low]) ? Low : INDEX_NONE;
+}
+}
+
+void FCompactSchemaDatabase::Build(const TMap<FString, FActorSchemaData>& ActorClassPathToSchema, const TMap<FString, FSubobjectSchemaData>& SubobjectClassPathToSchema,
+	const TMap<FString, uint32>& LevelPathToComponentId, const TMap<uint32, FString>& ComponentIdToClassPath, const TSet<uint32>& InLevelComponentIds)
+{
+	TSet<FString> UniqueClassPaths;
+	UniqueClassPaths.Reserve(ActorClassPathToSchema.Num() + SubobjectClassPathToSchema.Num());
+	for (const auto& ActorClassPathSchemaPair : ActorClassPathToSchema)
+	{
+		UniqueClassPaths.Add(ActorClassPathSchemaPair.Key);
+	}
+	for (const auto& SubobjectClassPathSchemaPair : SubobjectClassPathToSchema)
+	{
+		UniqueClassPaths.Add(SubobjectClassPathSchemaPair.Key);
+	}
+	for (const auto& ComponentIdClassPathPair : ComponentIdToClassPath)
+	{
+		UniqueClassPaths.Add(ComponentIdClassPathPair.Value);
+	}
+
+	ClassPaths = UniqueClassPaths.Array();
+	ClassPaths.Sort();
+
+	ActorSchemaIndices.Empty(ClassPaths.Num());
+	SubobjectSchemaIndices.Empty(ClassPaths.Num());
+	ActorSchemas.Empty(ActorClassPathToSchema.Num());
+	SubobjectSchemas.Empty(SubobjectClassPathToSchema.Num());
+
+	for (const FString& ClassPath : ClassPaths)
+	{
+		const FActorSchemaData* ActorSchemaData = ActorClassPathToSchema.Find(ClassPath);
+		ActorSchemaIndices.Add(ActorSchemaData != nullptr ? ActorSchemas.Add(*ActorSchemaData) : INDEX_NONE);
+
+		const FSubobjectSchemaData* SubobjectSchemaData = SubobjectClassPathToSchema.Find(ClassPath);
+		SubobjectSchemaIndices.Add(SubobjectSchemaData != nullptr ? SubobjectSchemas.Add(*SubobjectSchemaData) : INDEX_NONE);
+	}
+
+	ComponentIdToClassPath.GenerateKeyArray(ComponentIds);
+	ComponentIds.Sort();
+	ComponentClassPathIndices.Empty(ComponentIds.Num());
+	for (Worker_ComponentId ComponentId : ComponentIds)
+	{
+		ComponentClassPathIndices.Add(BinarySearch(ClassPaths, ComponentIdToClassPath[ComponentId]));
+	}
+
+	LevelPathToComponentId.GenerateKeyArray(LevelPaths);
+	LevelPaths.Sort();
+	LevelPathComponentIds.Empty(LevelPaths.Num());
+	for (const FString& LevelPath : LevelPaths)
+	{
+		LevelPathComponentIds.Add(LevelPathToComponentId[LevelPath]);
+	}
+
+	LevelComponentIds = InLevelComponentIds.Array();
+	LevelComponentIds.Sort();
+
+	BuildGeneration++;
+}
+
+void FCompactSchemaDatabase::Serialize(FArchive& Ar)
+{
+	Ar << ClassPaths;
+	Ar << ActorSchemaIndices;
+	Ar << SubobjectSchemaIndices;
+	SerializeArray(Ar, ActorSchemas, &SerializeActorSchemaData);
+	SerializeArray(Ar, SubobjectSchemas, &SerializeSubobjectSchemaData);
+	Ar << ComponentIds;
+	Ar << ComponentClassPathIndices;
+	Ar << LevelPaths;
+	Ar << LevelPathComponentIds;
+	Ar << LevelComponentIds;
+
+	if (Ar.IsLoading())
+	{
+		BuildGeneration++;
+	}
+}
+
+int32 FCompactSchemaDatabase::FindClassPathIndex(const FString& ClassPath) const
+{
+	return BinarySearch(ClassPaths, ClassPath);
+}
+
+const FActorSchemaData* FCompactSchemaDatabase::FindActorSchemaData(const FString& ClassPath) const
+{
+	const int32 ClassPathIndex = FindClassPathIndex(ClassPath);
+	if (ClassPathIndex == INDEX_NONE || ActorSchemaIndices[ClassPathIndex] == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return &ActorSchemas[ActorSchemaIndices[ClassPathIndex]];
+}
+
+const FSubobjectSchemaData* FCompactSchemaDatabase::FindSubobjectSchemaData(const FString& ClassPath) const
+{
+	const int32 ClassPathIndex = FindClassPathIndex(ClassPath);
+	if (ClassPathIndex == INDEX_NONE || SubobjectSchemaIndices[ClassPathIndex] == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return &SubobjectSchemas[SubobjectSchemaIndices[ClassPathIndex]];
+}
+
+const FString* FCompactSchemaDatabase::FindClassPathForComponentId(Worker_ComponentId ComponentId) const
+{
+	const int32 ComponentIdIndex = BinarySearch(ComponentIds, ComponentId);
+	if (ComponentIdIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return &ClassPaths[ComponentClassPathIndices[ComponentIdIndex]];
+}
+
+Worker_ComponentId FCompactSchemaDatabase::GetComponentIdForLevelPath(const FString& LevelPath) const
+{
+	const int32 LevelPathIndex = BinarySearch(LevelPaths, LevelPath);
+	if (LevelPathIndex == INDEX_NONE)
+	{
+		return SpatialConstants::INVALID_COMPONENT_ID;
+	}
+
+	return LevelPathComponentIds[LevelPathIndex];
+}
+
+bool FCompactSchemaDatabase::IsLevelComponent(Worker_ComponentId ComponentId) const
+{
+	return BinarySearch(LevelComponentIds, ComponentId) != INDEX_NONE;
+}
+
+void USchemaDatabase::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(FSchemaDatabaseCustomVersion::GUID);
+
+	if ((Ar.IsLoading() || Ar.IsSaving()) && !Ar.IsTransacting() && Ar.CustomVer(FSchemaDatabaseCustomVersion::GUID) >= FSchemaDatabaseCustomVersion::AddedCompactSchemaDatabase)
+	{
+		CompactSchemaDatabase.Serialize(Ar);
+	}
+}
+
+void USchemaDatabase::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	// The maps are authoritative whenever they're present, which also covers schema databases saved before the compact form existed.
+	BuildCompactSchemaDatabase();
+#endif
+}
+
+#if WITH_EDITOR
+void USchemaDatabase::PreSave(const ITargetPlatform* TargetPlatform)
+{
+	Super::PreSave(TargetPlatform);
+
+	BuildCompactSchemaDatabase();
+}
+#endif
+
+void USchemaDatabase::BuildCompactSchemaDatabase()
+{
+#if WITH_EDITORONLY_DATA
+	CompactSchemaDatabase.Build(ActorClassPathToSchema, SubobjectClassPathToSchema, LevelPathToComponentId, ComponentIdToClassPath, LevelComponentIds);
+#endif
+}
@@ -20,7 +20,7 @@ void GetFullPathFromUnrealObjectReference(const FUnrealObjectRef& ObjectRef, FSt
 		OutPath.Append(TEXT("."));
 	}
 
-	OutPath.Append(*ObjectRef.Path);
+	ObjectRef.Path->AppendString(OutPath);
 }
 
 } // namespace SpatialGDK
@@ -0,0 +1,86 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialActorGrid.h"
+
+#include "Engine/EngineTypes.h"
+#include "GameFramework/Actor.h"
+
+FSpatialActorGrid::FSpatialActorGrid()
+	: CellSize(5000.0f)
+{
+}
+
+void FSpatialActorGrid::SetCellSize(float InCellSize)
+{
+	check(InCellSize > 0.0f);
+
+	if (InCellSize == CellSize)
+	{
+		return;
+	}
+
+	// Existing cells are no longer meaningful, Actors will be re-added on their next position update.
+	CellSize = InCellSize;
+	ActorToCell.Empty();
+	CellToViewers.Empty();
+}
+
+void FSpatialActorGrid::UpdateActor(const AActor* Actor, const FVector& Location)
+{
+	ActorToCell.Add(Actor, FActorCell{ GetCell(Location), Location });
+}
+
+void FSpatialActorGrid::RemoveActor(const AActor* Actor)
+{
+	ActorToCell.Remove(Actor);
+}
+
+void FSpatialActorGrid::UpdateViewers(const TArray<FNetViewer>& Viewers, float CullDistance)
+{
+	CellToViewers.Reset();
+
+	const float CullDistanceSquared = FMath::Square(CullDistance);
+
+	for (int32 ViewerIndex = 0; ViewerIndex < Viewers.Num(); ViewerIndex++)
+	{
+		const FVector& ViewLocation = Viewers[ViewerIndex].ViewLocation;
+		const FIntPoint MinCell = GetCell(ViewLocation - FVector(CullDistance, CullDistance, 0.0f));
+		const FIntPoint MaxCell = GetCell(ViewLocation + FVector(CullDistance, CullDistance, 0.0f));
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				// Skip the corners of the square that fall entirely outside the cull distance.
+				const FBox2D CellBounds(FVector2D(X * CellSize, Y * CellSize), FVector2D((X + 1) * CellSize, (Y + 1) * CellSize));
+				if (CellBounds.ComputeSquaredDistanceToPoint(FVector2D(ViewLocation)) > CullDistanceSquared)
+				{
+					continue;
+				}
+
+				CellToViewers.FindOrAdd(FIntPoint(X, Y)).Add(ViewerIndex);
+			}
+		}
+	}
+}
+
+const FSpatialActorGrid::FViewerIndices* FSpatialActorGrid::GetViewersForActor(const AActor* Actor) const
+{
+	if (const FActorCell* ActorCell = ActorToCell.Find(Actor))
+	{
+		return CellToViewers.Find(ActorCell->Cell);
+	}
+
+	return nullptr;
+}
+
+const FVector* FSpatialActorGrid::GetActorLocation(const AActor* Actor) const
+{
+	const FActorCell* ActorCell = ActorToCell.Find(Actor);
+	return ActorCell != nullptr ? &ActorCell->Location : nullptr;
+}
+
+FIntPoint FSpatialActorGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
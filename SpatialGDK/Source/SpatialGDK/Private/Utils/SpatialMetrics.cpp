@@ -11,6 +11,7 @@
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/EntityPool.h"
 #include "Utils/SchemaUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialMetrics);
@@ -49,6 +50,30 @@ void USpatialMetrics::TickMetrics()
 	DynamicFPSMetrics.GaugeMetrics.Add(DynamicFPSGauge);
 	DynamicFPSMetrics.Load = WorkerLoad;
 
+	auto AddGauge = [&DynamicFPSMetrics](const FString& Key, double Value)
+	{
+		SpatialGDK::GaugeMetric Gauge;
+		Gauge.Key = TCHAR_TO_UTF8(*Key);
+		Gauge.Value = Value;
+		DynamicFPSMetrics.GaugeMetrics.Add(Gauge);
+	};
+
+	if (NetDriver->IsServer() && GetDefault<USpatialGDKSettings>()->bEnableAdaptiveReplicationBudget)
+	{
+		const FAdaptiveReplicationBudget& ReplicationBudget = NetDriver->ReplicationBudget;
+
+		AddGauge(SpatialConstants::SPATIALOS_METRICS_REPLICATION_BUDGET_MS, ReplicationBudget.GetBudget() * 1000.0);
+		AddGauge(SpatialConstants::SPATIALOS_METRICS_SERVER_REPLICATE_ACTORS_MS, ReplicationBudget.GetServerReplicateActorsTime() * 1000.0);
+		AddGauge(SpatialConstants::SPATIALOS_METRICS_QUEUED_OUTGOING_MESSAGES, ReplicationBudget.GetNumQueuedMessages());
+		AddGauge(SpatialConstants::SPATIALOS_METRICS_DEFERRED_ACTORS, ReplicationBudget.GetNumDeferredActors());
+	}
+
+	if (NetDriver->IsServer() && NetDriver->EntityPool != nullptr && NetDriver->EntityPool->IsReady())
+	{
+		AddGauge(SpatialConstants::SPATIALOS_METRICS_ENTITY_POOL_REMAINING_IDS, NetDriver->EntityPool->GetNumRemainingEntityIds());
+		AddGauge(SpatialConstants::SPATIALOS_METRICS_ENTITY_POOL_STARVED_ALLOCATIONS, NetDriver->EntityPool->GetNumStarvedAllocations());
+	}
+
 	TimeOfLastReport = NetDriver->Time;
 	FramesSinceLastReport = 0;
 
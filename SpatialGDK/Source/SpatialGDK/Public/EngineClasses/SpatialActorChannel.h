@@ -9,6 +9,7 @@
 #include "Interop/SpatialClassInfoManager.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include "Schema/Interest.h"
 #include "Schema/StandardLibrary.h"
 #include "SpatialCommonTypes.h"
 #include "Utils/RepDataUtils.h"
@@ -122,10 +123,20 @@ public:
 
 	bool TryResolveActor();
 
+	// Whether CompareProperties can be used for this channel this frame. Must be called on the game thread.
+	bool CanCompareProperties();
+
+	// Runs the property comparison ReplicateActor would do for the Actor and its subobjects this replication frame, without sending anything.
+	// Only touches state owned by this channel, so can be called for different channels in parallel. Info is the class info of the
+	// Actor's class, looked up on the game thread beforehand as looking it up may create it.
+	void CompareProperties(const FClassInfo& Info);
+
 	bool ReplicateSubobject(UObject* Obj, const FReplicationFlags& RepFlags);
 	virtual bool ReplicateSubobject(UObject* Obj, FOutBunch& Bunch, const FReplicationFlags& RepFlags) override;
 
-	TMap<UObject*, const FClassInfo*> GetHandoverSubobjects();
+	// Subobjects of this channel's Actor that have handover properties, with their class info.
+	// Resolved on first use and cached until subobjects are attached or removed.
+	const TArray<TPair<TWeakObjectPtr<UObject>, const FClassInfo*>>& GetHandoverSubobjects();
 
 	FRepChangeState CreateInitialRepChangeState(TWeakObjectPtr<UObject> Object);
 	FHandoverChangeState CreateInitialHandoverChangeState(const FClassInfo& ClassInfo);
@@ -143,15 +154,28 @@ public:
 	void RemoveRepNotifiesWithUnresolvedObjs(TArray<UProperty*>& RepNotifies, const FRepLayout& RepLayout, const FObjectReferencesMap& RefMap, UObject* Object);
 	
 	void UpdateShadowData();
+	// Updates the SpatialOS position now or with the next batch of position updates, depending on bBatchSpatialPositionUpdates.
+	void QueueSpatialPositionUpdate();
 	void UpdateSpatialPositionWithFrequencyCheck();
 	void UpdateSpatialPosition();
 
-	void ServerProcessOwnershipChange();
+	// Updates the EntityACL for a change of owner. Called by USpatialSender::ProcessOwnershipChanges for each Actor in the changed hierarchy.
+	// Returns false if this server isn't authoritative over the entity, in which case the Actor's children are skipped too.
+	bool ServerProcessOwnershipChange();
 	void ClientProcessOwnershipChange(bool bNewNetOwned);
 
 	FORCEINLINE void MarkInterestDirty() { bInterestDirty = true; }
+
+	// Called by USpatialNetDriver::OnOwnerUpdated when an Actor joins this channel's Actor's ownership hierarchy.
+	FORCEINLINE void InvalidatePositionHierarchy() { bPositionHierarchyDirty = true; }
 	FORCEINLINE bool GetInterestDirty() const { return bInterestDirty; }
 
+	// Called by USpatialReceiver when a data component of this channel's Actor or one of its subobjects is removed from the worker's view
+	// while the entity stays checked out, and when it's added back. The properties in a stale component keep the last values received.
+	FORCEINLINE void MarkComponentStale(Worker_ComponentId ComponentId) { StaleComponents.Add(ComponentId); }
+	FORCEINLINE void ClearComponentStale(Worker_ComponentId ComponentId) { StaleComponents.Remove(ComponentId); }
+	FORCEINLINE bool HasStaleComponents() const { return StaleComponents.Num() > 0; }
+
 	bool IsListening() const;
 	const FClassInfo* TryResolveNewDynamicSubobjectAndGetClassInfo(UObject* Object);
 
@@ -169,10 +193,15 @@ private:
 	void DeleteEntityIfAuthoritative();
 	bool IsSingletonEntity();
 
-	void SendPositionUpdate(AActor* InActor, Worker_EntityId InEntityId, const FVector& NewPosition);
+	// Sends NewPosition for this channel's Actor and every Actor it owns, directly or indirectly.
+	void SendPositionUpdates(const FVector& NewPosition);
+	bool IsPositionHierarchyValid() const;
+	void RebuildPositionHierarchy();
+	void AddToPositionHierarchy(AActor* InActor);
 
-	void InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object);
-	FHandoverChangeState GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object);
+	void InitializeHandoverShadowData(UObject* Object, const FClassInfo& Info);
+	void ReleaseHandoverShadowData();
+	FHandoverChangeState GetHandoverChangeList(uint8* ShadowData, UObject* Object, const FClassInfo& ClassInfo);
 	
 	void UpdateEntityACLToNewOwner();
 
@@ -185,6 +214,14 @@ public:
 
 	TSet<TWeakObjectPtr<UObject>> PendingDynamicSubobjects;
 
+	// Used on the client to only send the component interest overrides which change when ownership toggles, indexed by the new bNetOwned.
+	// Built by USpatialSender::SendComponentInterestForActor, which sends the full set of overrides again after this is marked dirty.
+	TArray<Worker_InterestOverride> ComponentInterestDelta[2];
+	bool bComponentInterestDirty;
+
+	// The Interest component last sent for this entity, used to skip Interest updates which wouldn't change anything.
+	SpatialGDK::LastSentInterest SentInterest;
+
 private:
 	Worker_EntityId EntityId;
 	bool bInterestDirty;
@@ -206,10 +243,38 @@ private:
 	FVector LastPositionSinceUpdate;
 	float TimeWhenPositionLastUpdated;
 
+	struct FPositionHierarchyEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		Worker_EntityId EntityId;
+		int32 NumChildren;
+		TWeakObjectPtr<AActor> Owner;
+	};
+
+	// This Actor and the Actors it owns, with their entity IDs, in the order their positions are updated.
+	// Rebuilt when an Actor joins the hierarchy (see InvalidatePositionHierarchy), when an entry's owner or
+	// children change or while an entry's entity ID hasn't been resolved yet.
+	TArray<FPositionHierarchyEntry> PositionHierarchy;
+	bool bPositionHierarchyDirty;
+	TWeakObjectPtr<APawn> PositionHierarchyPawn;
+	bool bPositionHierarchyHasUnresolvedEntities;
+
+	// Data components removed from the worker's view while the entity is still checked out (see MarkComponentStale).
+	TSet<Worker_ComponentId> StaleComponents;
+
 	// Shadow data for Handover properties.
 	// For each object with handover properties, we store a blob of memory which contains
 	// the state of those properties at the last time we sent them, and is used to detect
-	// when those properties change.
-	TArray<uint8>* ActorHandoverShadowData;
-	TMap<TWeakObjectPtr<UObject>, TSharedRef<TArray<uint8>>> HandoverShadowDataMap;
+	// when those properties change. The blobs are allocated from per-class arenas owned by the net driver.
+	uint8* ActorHandoverShadowData;
+	TMap<TWeakObjectPtr<UObject>, FHandoverShadowData> HandoverShadowDataMap;
+
+	// Bytes of serialized component data and updates sent by the current call to ReplicateActor, including its subobjects.
+	int64 ReplicationBytesWritten;
+
+	TArray<TPair<TWeakObjectPtr<UObject>, const FClassInfo*>> CachedHandoverSubobjects;
+	bool bHandoverSubobjectsDirty;
+
+	// Actor handover properties found to have changed by CompareProperties, sent on the next call to ReplicateActor.
+	FHandoverChangeState PendingActorHandoverChanges;
 };
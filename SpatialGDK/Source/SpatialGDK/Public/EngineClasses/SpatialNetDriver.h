@@ -13,6 +13,10 @@
 #include "Interop/SpatialOutputDevice.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/AdaptiveReplicationBudget.h"
+#include "Utils/HandoverShadowArena.h"
+#include "Utils/ReplicationTimingWheel.h"
+#include "Utils/SpatialActorGrid.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -68,11 +72,16 @@ public:
 	virtual void TickFlush(float DeltaTime) override;
 	virtual bool IsLevelInitializedForActor(const AActor* InActor, const UNetConnection* InConnection) const override;
 	virtual void NotifyActorDestroyed(AActor* Actor, bool IsSeamlessTravel = false) override;
+	virtual void ForceNetUpdate(AActor* Actor) override;
+	virtual void FlushActorDormancy(AActor* Actor, bool bWasDormInitial = false) override;
 	virtual void Shutdown() override;
 	// End UNetDriver interface.
 
 	virtual void OnOwnerUpdated(AActor* Actor);
 
+	// Schedules the actor to be considered for replication on the next tick when using the persistent consider list.
+	void AddActorToConsiderList(AActor* Actor);
+
 	void OnConnectedToSpatialOS();
 
 #if !UE_BUILD_SHIPPING
@@ -89,6 +98,9 @@ public:
 	// When the AcceptingPlayers state on the GSM has changed this method will be called.
 	void OnAcceptingPlayersChanged(bool bAcceptingPlayers);
 
+	// When the actor group assignments on the GSM have changed this method will be called, on every server worker.
+	void ApplyActorGroupAssignments(const TMap<FString, FString>& OffloadedActorGroupToWorkerType);
+
 	// Used by USpatialSpawner (when new players join the game) and USpatialInteropPipelineBlock (when player controllers are migrated).
 	USpatialNetConnection* AcceptNewPlayer(const FURL& InUrl, FUniqueNetIdRepl UniqueId, FName OnlinePlatformName, bool bExistingPlayer);
 
@@ -98,6 +110,9 @@ public:
 
 	USpatialActorChannel* GetOrCreateSpatialActorChannel(UObject* TargetObject);
 	USpatialActorChannel* GetActorChannelByEntityId(Worker_EntityId EntityId) const;
+	// Whether some of the Actor's replicated properties, or those of its subobjects, are no longer being received because
+	// the client's interest stopped including their components (e.g. in a client interest band without them).
+	bool IsActorReplicatedDataStale(const AActor* Actor) const;
 	USpatialActorChannel* CreateSpatialActorChannel(AActor* Actor, USpatialNetConnection* InConnection);
 
 	DECLARE_DELEGATE(PostWorldWipeDelegate);
@@ -137,6 +152,20 @@ public:
 
 	TMap<UClass*, TPair<AActor*, USpatialActorChannel*>> SingletonActorChannels;
 
+	// Grid of replicated Actors by SpatialOS position, used for relevancy when bUseReplicationGrid is enabled.
+	FSpatialActorGrid ActorGrid;
+
+	// Time budget for replicating Actors each tick, used when bEnableAdaptiveReplicationBudget is enabled.
+	FAdaptiveReplicationBudget ReplicationBudget;
+
+	float GetPositionDistanceThresholdSquared() const { return PositionDistanceThresholdSquared; }
+
+	// Scratch buffer used by actor channels when merging changelists, kept here so its allocation is reused across channels.
+	TArray<uint16> ChangelistMergeScratch;
+
+	// Allocates handover shadow data for an object of the class described by Info, from the arena shared by all objects of that class.
+	FHandoverShadowData AllocateHandoverShadowData(const FClassInfo& Info);
+
 	bool IsAuthoritativeDestructionAllowed() const { return bAuthoritativeDestruction; }
 	void StartIgnoringAuthoritativeDestruction() { bAuthoritativeDestruction = false; }
 	void StopIgnoringAuthoritativeDestruction() { bAuthoritativeDestruction = true; }
@@ -176,6 +205,7 @@ private:
 	TMap<Worker_EntityId_Key, USpatialActorChannel*> EntityToActorChannel;
 	TArray<Worker_OpList*> QueuedStartupOpLists;
 
+	TMap<TWeakObjectPtr<UClass>, TSharedRef<FHandoverShadowArena>> HandoverShadowArenas;
 	FTimerManager TimerManager;
 
 	bool bAuthoritativeDestruction;
@@ -215,12 +245,20 @@ private:
 	// SpatialGDK: These functions all exist in UNetDriver, but we need to modify/simplify them in certain ways.
 	// Could have marked them virtual in base class but that's a pointless source change as these functions are not meant to be called from anywhere except USpatialNetDriver::ServerReplicateActors.
 	int32 ServerReplicateActors_PrepConnections(const float DeltaSeconds);
+	void ServerReplicateActors_BuildSpatialConsiderList(TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime);
 	int32 ServerReplicateActors_PrioritizeActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors);
 	void ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated);
+	int32 ServerReplicateActors_CompareProperties(FActorPriority** PriorityActors, const int32 StartIndex, const int32 FinalSortedCount, const int32 MaxActorsToCompare);
 #endif
 
 	void ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters);
 
+	void ReconcileConsiderList();
+	void OnActorSpawned(AActor* Actor);
+
+	void UpdateLoadAwareOffloading();
+	TArray<FString> GetOwnedLoadAwareActorGroups();
+
 	friend USpatialNetConnection;
 	friend USpatialWorkerConnection;
 
@@ -238,6 +276,24 @@ private:
 
 	FDelegateHandle SpatialDeploymentStartHandle;
 
+	// Actors scheduled by their next net update time, used instead of walking the network object list when bUsePersistentConsiderList is set.
+	FReplicationTimingWheel ReplicationTimingWheel;
+	float TimeWhenConsiderListLastReconciled;
+	float TimeWhenWorkerLoadLastReported;
+
+	// Actors dropped from ReplicationTimingWheel while dormant or not authoritative, checked on each reconcile in case they came back through a path we don't hook.
+	TSet<TWeakObjectPtr<AActor>> ActorsDroppedFromConsiderList;
+	FDelegateHandle OnActorSpawnedDelegateHandle;
+
+	// Bytes of serialized entity creation requests and component updates sent by ServerReplicateActors this tick, across all connections.
+	int64 ReplicationBytesSentThisTick;
+
+	// Bytes sent by ServerReplicateActors this tick for the Actors owned by each client connection. Kept to reuse its allocation.
+	TMap<UNetConnection*, int64> ReplicationBytesSentPerOwningConnection;
+
+	// Cached from USpatialGDKSettings::PositionDistanceThreshold on init and once per tick.
+	float PositionDistanceThresholdSquared;
+
 #if !UE_BUILD_SHIPPING
 	int32 ConsiderListSize = 0;
 #endif
@@ -7,6 +7,7 @@
 
 #include "Schema/UnrealMetadata.h"
 #include "Schema/UnrealObjectRef.h"
+#include "SpatialCommonTypes.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -83,8 +84,13 @@ public:
 	FNetworkGUID GetNetGUIDFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef);
 	FUnrealObjectRef GetUnrealObjectRefFromNetGUID(const FNetworkGUID& NetGUID) const;
 	FNetworkGUID GetNetGUIDFromEntityId(Worker_EntityId EntityId) const;
+	Worker_EntityId GetEntityIdFromObject(const UObject* Object) const;
 
 	void NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRef, bool bReading) const;
+	FName NetworkRemapPath(FName Path, bool bReading) const;
+
+	// Remapping depends on the world and its levels, so this must be called whenever they change.
+	void ClearRemappedPaths();
 
 	// This function is ONLY used in SpatialPackageMapClient::UnregisterActorObjectRefOnly
 	// to undo the unintended registering of objects when looking them up with static paths.
@@ -96,10 +102,31 @@ private:
 	FNetworkGUID GetOrAssignNetGUID_SpatialGDK(UObject* Object);
 	void RegisterObjectRef(FNetworkGUID NetGUID, const FUnrealObjectRef& ObjectRef);
 	
-	FNetworkGUID RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient);
+	FNetworkGUID RegisterNetGUIDFromPathForStaticObject(FName PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient);
 	FNetworkGUID GenerateNewNetGUID(const int32 IsStatic);
 
+	using FEntityOffset = TPair<Worker_EntityId_Key, uint32>;
+
+	static bool IsEntityObjectRef(const FUnrealObjectRef& ObjectRef) { return !ObjectRef.Path.IsSet() && !ObjectRef.Outer.IsSet(); }
+
+	const FNetworkGUID* FindNetGUID(const FUnrealObjectRef& ObjectRef) const;
+	void AddObjectRefToNetGUID(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID);
+	void RemoveObjectRefToNetGUID(const FUnrealObjectRef& ObjectRef);
+	void RemoveNetGUIDToObjectRef(const FNetworkGUID& NetGUID);
+
 	TMap<FNetworkGUID, FUnrealObjectRef> NetGUIDToUnrealObjectRef;
+
+	// Refs with a path or an outer, i.e. stably named objects.
 	TMap<FUnrealObjectRef, FNetworkGUID> UnrealObjectRefToNetGUID;
+
+	// Refs that are only an entity ID and offset, i.e. entity actors and their subobjects, which make up most lookups.
+	// Keyed on the entity ID and offset so lookups don't hash or compare a whole FUnrealObjectRef.
+	TMap<FEntityOffset, FNetworkGUID> EntityOffsetToNetGUID;
+
+	// Entity of every entity actor and subobject registered, so GetEntityIdFromObject doesn't need to copy its ref.
+	TMap<TWeakObjectPtr<const UObject>, Worker_EntityId_Key> ObjectToEntityId;
+
+	// Results of GEngine->NetworkRemapPath, keyed on the path and whether it was remapped for reading.
+	mutable TMap<TPair<FName, bool>, FName> RemappedPaths;
 };
 
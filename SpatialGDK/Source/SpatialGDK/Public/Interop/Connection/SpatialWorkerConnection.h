@@ -4,6 +4,7 @@
 #include "Containers/Queue.h"
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 
 #include "Interop/Connection/ConnectionConfig.h"
 #include "Interop/Connection/OutgoingMessages.h"
@@ -58,6 +59,9 @@ public:
 	Worker_RequestId SendEntityQueryRequest(const Worker_EntityQuery* EntityQuery);
 	void SendMetrics(const SpatialGDK::SpatialMetrics& Metrics);
 
+	// Number of messages queued on the game thread that haven't been sent to the SpatialOS runtime yet.
+	int32 GetNumQueuedOutgoingMessages() const { return NumQueuedOutgoingMessages.GetValue(); }
+
 	FString GetWorkerId() const;
 	const TArray<FString>& GetWorkerAttributes() const;
 
@@ -112,6 +116,7 @@ private:
 
 	TQueue<Worker_OpList*> OpListQueue;
 	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueue;
+	FThreadSafeCounter NumQueuedOutgoingMessages;
 
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
 	Worker_RequestId NextRequestId = 0;
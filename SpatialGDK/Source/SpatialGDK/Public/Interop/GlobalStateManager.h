@@ -32,10 +32,12 @@ public:
 	void ApplySingletonManagerData(const Worker_ComponentData& Data);
 	void ApplyDeploymentMapData(const Worker_ComponentData& Data);
 	void ApplyStartupActorManagerData(const Worker_ComponentData& Data);
+	void ApplyActorGroupAssignmentsData(const Worker_ComponentData& Data);
 
 	void ApplySingletonManagerUpdate(const Worker_ComponentUpdate& Update);
 	void ApplyDeploymentMapUpdate(const Worker_ComponentUpdate& Update);
 	void ApplyStartupActorManagerUpdate(const Worker_ComponentUpdate& Update);
+	void ApplyActorGroupAssignmentsUpdate(const Worker_ComponentUpdate& Update);
 
 	bool IsSingletonEntity(Worker_EntityId EntityId) const;
 	void LinkAllExistingSingletonActors();
@@ -50,6 +52,18 @@ public:
 
 	void SetAcceptingPlayers(bool bAcceptingPlayers);
 	void SetCanBeginPlay(const bool bInCanBeginPlay);
+	void SetOffloadedActorGroups(const StringToStringMap& InOffloadedActorGroupToWorkerType);
+
+	bool HasActorGroupAssignmentsAuthority() const;
+
+	// Sends this worker's load to the worker authoritative over the actor group assignments, which decides the load-aware reassignments.
+	void SendWorkerLoadReport(FName WorkerType, double Load, const TArray<FString>& OwnedActorGroups);
+	void ReceiveWorkerLoadReport(Schema_Object* Payload, const char* CallerWorkerAttribute);
+
+	static Worker_ComponentUpdate CreateActorGroupAssignmentsUpdate(const StringToStringMap& InOffloadedActorGroupToWorkerType);
+	static StringToStringMap GetOffloadedActorGroupsFromUpdate(const Worker_ComponentUpdate& Update);
+	static Worker_CommandRequest CreateWorkerLoadReportRequest(FName WorkerType, double Load, const TArray<FString>& OwnedActorGroups);
+	static void ReadWorkerLoadReport(Schema_Object* Payload, FName& OutWorkerType, double& OutLoad, TArray<FString>& OutOwnedActorGroups);
 
 	void AuthorityChanged(const Worker_AuthorityChangeOp& AuthChangeOp);
 	bool HandlesComponent(const Worker_ComponentId ComponentId) const;
@@ -80,6 +94,9 @@ public:
 	// Startup Actor Manager Component
 	bool bCanBeginPlay;
 
+	// Actor Group Assignments Component
+	StringToStringMap OffloadedActorGroupToWorkerType;
+
 #if WITH_EDITOR
 	void OnPrePIEEnded(bool bValue);
 	void ReceiveShutdownMultiProcessRequest();
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Utils/ClientInterestDistances.h"
 #include "Utils/SchemaDatabase.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -41,6 +42,25 @@ struct FHandoverPropertyInfo
 	int32 Offset;
 	int32 ArrayIdx;
 	UProperty* Property;
+
+	// Offset of this property in the handover shadow data of an object of this class.
+	int32 ShadowOffset;
+};
+
+// A run of handover properties compared in one go.
+// Properties that can be compared byte by byte and are adjacent in the object are grouped so that
+// a single memcmp covers all of them, other properties are compared with UProperty::Identical one at a time.
+struct FHandoverShadowSpan
+{
+	int32 Offset;
+	int32 ShadowOffset;
+	int32 Size;
+
+	// Range of HandoverProperties covered by this span.
+	int32 FirstProperty;
+	int32 NumProperties;
+
+	bool bMemoryComparable;
 };
 
 struct FInterestPropertyInfo
@@ -60,6 +80,8 @@ struct FClassInfo
 	TArray<UFunction*> RPCs;
 	TMap<UFunction*, FRPCInfo> RPCInfoMap;
 	TArray<FHandoverPropertyInfo> HandoverProperties;
+	TArray<FHandoverShadowSpan> HandoverShadowSpans;
+	int32 HandoverShadowDataSize = 0;
 	TArray<FInterestPropertyInfo> InterestProperties;
 
 	// For Actors and default Subobjects belonging to Actors
@@ -67,6 +89,7 @@ struct FClassInfo
 
 	// Only for Actors
 	TMap<uint32, TSharedRef<const FClassInfo>> SubobjectInfo;
+	TMap<FName, uint32> SubobjectNameToOffset;
 
 	// Only for default Subobjects belonging to Actors
 	FName SubobjectName;
@@ -76,6 +99,8 @@ struct FClassInfo
 
 	FName ActorGroup;
 	FName WorkerType;
+	// Index of WorkerType in the actor group manager, for comparing worker types as integers.
+	int32 WorkerTypeIndex = 0;
 };
 
 class UActorGroupManager;
@@ -112,16 +137,43 @@ public:
 	uint32 GetComponentIdFromLevelPath(const FString& LevelPath);
 	bool IsSublevelComponent(Worker_ComponentId ComponentId);
 
+	// Refreshes the worker type of the class infos in this actor group, after the actor group manager reassigned it.
+	void UpdateWorkerTypeForActorGroup(FName ActorGroup);
+
+	// Class info warm-up builds the class info of every loaded class in the schema database ahead of time, so it isn't built
+	// the first time an Actor of that class is replicated. Each tick processes classes until the budget is used up.
+	void StartClassInfoWarmUp();
+	void TickClassInfoWarmUp(float BudgetMs);
+	bool IsClassInfoWarmUpInProgress() const { return ClassInfoWarmUpIndex < ClassInfoWarmUpPaths.Num(); }
+	float GetClassInfoWarmUpProgress() const;
+
+	// Gathered by server workers only, updated as Actor classes are registered.
+	SpatialGDK::ClientInterestDistances& GetClientInterestDistances() { return InterestDistances; }
+
 	UPROPERTY()
 	USchemaDatabase* SchemaDatabase;
 
 private:
 	void CreateClassInfoForClass(UClass* Class);
+	void AddClassInfoForClass(UClass* Class, TSharedRef<FClassInfo> Info);
 	void TryCreateClassInfoForComponentId(Worker_ComponentId ComponentId);
 
 	void FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info);
 	void FinishConstructingSubobjectClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info);
 
+	struct FComponentIdInfo
+	{
+		TSharedPtr<FClassInfo> ClassInfo;
+		uint32 Offset = 0;
+		ESchemaComponentType Category = SCHEMA_Invalid;
+	};
+
+	void AddComponentIdInfo(Worker_ComponentId ComponentId, const TSharedRef<FClassInfo>& Info, uint32 Offset, ESchemaComponentType Category);
+	const FComponentIdInfo* FindComponentIdInfo(Worker_ComponentId ComponentId) const;
+	const FComponentIdInfo* FindOrCreateComponentIdInfo(Worker_ComponentId ComponentId);
+	const FString* FindClassPathForComponentId(Worker_ComponentId ComponentId) const;
+	bool IsGeneratedComponentIdInDenseRange(Worker_ComponentId ComponentId) const;
+
 	void QuitGame();
 
 private:
@@ -132,7 +184,19 @@ private:
 	UActorGroupManager* ActorGroupManager;
 
 	TMap<TWeakObjectPtr<UClass>, TSharedRef<FClassInfo>> ClassInfoMap;
-	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
-	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
-	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+
+	// Subobject classes come first, so they are already built when the Actor classes that contain them are.
+	TArray<FString> ClassInfoWarmUpPaths;
+	int32 ClassInfoWarmUpIndex = 0;
+
+	// Generated component IDs are dense from STARTING_GENERATED_COMPONENT_ID up to the schema database's NextAvailableComponentId,
+	// so they are looked up by index. Any other ID falls back to the maps.
+	TArray<FComponentIdInfo> GeneratedComponentIdInfos;
+	// Indices into the compact schema database's class paths, INDEX_NONE for IDs without a class.
+	// Only valid while the database's build generation matches GeneratedComponentIdClassPathsGeneration.
+	TArray<int32> GeneratedComponentIdClassPathIndices;
+	uint32 GeneratedComponentIdClassPathsGeneration = 0;
+	TMap<Worker_ComponentId, FComponentIdInfo> ComponentIdInfoMap;
+
+	SpatialGDK::ClientInterestDistances InterestDistances;
 };
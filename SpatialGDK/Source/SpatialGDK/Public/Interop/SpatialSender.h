@@ -66,6 +66,22 @@ using FOutgoingRepUpdates = TMap<TWeakObjectPtr<const UObject>, FChannelToHandle
 using FUpdatesQueuedUntilAuthority = TMap<Worker_EntityId_Key, TArray<Worker_ComponentUpdate>>;
 using FChannelsToUpdatePosition = TSet<TWeakObjectPtr<USpatialActorChannel>>;
 
+// The parts of an entity creation request which only depend on the Actor's class, built once per class.
+struct FEntityCreationTemplate
+{
+	// PlayerControllers are additionally readable by their owning client, which is added per entity.
+	WorkerRequirementSet ReadAcl;
+
+	// Write ACL for the components every entity of this class has, excluding the owning client's components.
+	WriteAclMap ComponentWriteAcl;
+
+	// Static subobjects aren't guaranteed to exist on Actor instances, so their components are only added when they do.
+	TArray<TPair<uint32, TArray<Worker_ComponentId>>> StaticSubobjectComponentIds;
+
+	bool bIsPlayerController;
+	bool bIsSingleton;
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialSender : public UObject
 {
@@ -75,7 +91,8 @@ public:
 	void Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager);
 
 	// Actor Updates
-	void SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges);
+	// Returns the number of bytes of serialized component updates sent or queued.
+	int64 SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges);
 	void SendComponentInterestForActor(USpatialActorChannel* Channel, Worker_EntityId EntityId, bool bNetOwned);
 	void SendComponentInterestForSubobject(const FClassInfo& Info, Worker_EntityId EntityId, bool bNetOwned);
 	void SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location);
@@ -85,7 +102,8 @@ public:
 	void SendAddComponent(USpatialActorChannel* Channel, UObject* Subobject, const FClassInfo& Info);
 	void SendRemoveComponent(Worker_EntityId EntityId, const FClassInfo& Info);
 
-	void SendCreateEntityRequest(USpatialActorChannel* Channel);
+	// Returns the number of bytes of serialized component data in the request.
+	int64 SendCreateEntityRequest(USpatialActorChannel* Channel);
 	void SendDeleteEntityRequest(Worker_EntityId EntityId);
 
 	void SendRequestToClearRPCsOnEntityCreation(Worker_EntityId EntityId);
@@ -105,6 +123,9 @@ public:
 	void SendOutgoingRPCs();
 
 	bool UpdateEntityACLs(Worker_EntityId EntityId, const FString& OwnerWorkerAttribute);
+	bool UpdateEntityACLWorkerType(Worker_EntityId EntityId, FName WorkerType);
+	// Moves the entities of this actor group this worker has EntityACL authority over to the group's current worker type.
+	void UpdateActorGroupWorkerType(FName ActorGroup);
 	void UpdateInterestComponent(AActor* Actor);
 
 	void ProcessRPC(FPendingRPCParamsPtr Params);
@@ -113,6 +134,11 @@ public:
 
 	void FlushPackedRPCs();
 
+	// Ownership changes are processed in batches, at the latest when the next RPC is sent or at the end of the frame.
+	// This ensures at most one EntityACL update per entity per batch, however many of its owners changed.
+	void QueueOwnershipChange(USpatialActorChannel* Channel);
+	void ProcessOwnershipChanges();
+
 	RPCPayload CreateRPCPayloadFromParams(UObject* TargetObject, UFunction* Function, int ReliableRPCIndex, void* Params, TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects);
 	void GainAuthorityThenAddComponent(USpatialActorChannel* Channel, UObject* Object, const FClassInfo* Info);
 
@@ -121,8 +147,9 @@ public:
 
 private:
 	// Actor Lifecycle
-	Worker_RequestId CreateEntity(USpatialActorChannel* Channel);
+	Worker_RequestId CreateEntity(USpatialActorChannel* Channel, int64& OutBytesWritten);
 	Worker_ComponentData CreateLevelComponentData(AActor* Actor);
+	const FEntityCreationTemplate& GetOrCreateEntityCreationTemplate(UClass* Class, const FClassInfo& Info);
 
 	// Queuing
 	void ResetOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, bool bIsHandover);
@@ -137,6 +164,7 @@ private:
 	bool AddPendingRPC(UObject* TargetObject, const FPendingRPCParams& Parameters, Worker_ComponentId ComponentId, Schema_FieldId RPCIndex, const UObject*& OutUnresolvedObject);
 
 	TArray<Worker_InterestOverride> CreateComponentInterestForActor(USpatialActorChannel* Channel, bool bIsNetOwned);
+	const TArray<Worker_InterestOverride>& GetOrCreateClassComponentInterest(UClass* Class, bool bIsNetOwned);
 
 private:
 	UPROPERTY()
@@ -173,11 +201,17 @@ private:
 
 	TMap<Worker_RequestId, USpatialActorChannel*> PendingActorRequests;
 
+	TMap<TWeakObjectPtr<UClass>, FEntityCreationTemplate> EntityCreationTemplates;
+
+	// Component interest overrides for an Actor class and its static subobjects, keyed by class and whether the Actor is net-owned.
+	TMap<TPair<TWeakObjectPtr<UClass>, bool>, TArray<Worker_InterestOverride>> ClassComponentInterest;
+
 	TArray<TSharedRef<FReliableRPCForRetry>> RetryRPCs;
 
 	FUpdatesQueuedUntilAuthority UpdatesQueuedUntilAuthorityMap;
 
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
+	TSet<TWeakObjectPtr<USpatialActorChannel>> ChannelsWithOwnershipChange;
 
 	TMap<Worker_EntityId_Key, TArray<FPendingRPC>> RPCsToPack;
 };
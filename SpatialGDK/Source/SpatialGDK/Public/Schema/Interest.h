@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Misc/SecureHash.h"
+
 #include "StandardLibrary.h"
 
 namespace SpatialGDK
@@ -82,6 +84,11 @@ struct QueryConstraint
 			return true;
 		}
 
+		if (RelativeBoxConstraint.IsSet())
+		{
+			return true;
+		}
+
 		if (EntityIdConstraint.IsSet())
 		{
 			return true;
@@ -254,6 +261,117 @@ inline void AddComponentInterestToInterestSchema(Schema_Object* InterestObject,
 	}
 }
 
+// Digests of the Interest types. Each field is fed in with its schema field ID, and nested objects end with an
+// InterestDigestObjectEnd marker, so Interest components which would serialize differently get different digests.
+// SHA-1 makes a collision practically impossible, so a matching digest is enough to skip sending an update.
+static const Schema_FieldId InterestDigestObjectEnd = 0;
+
+// Only used with types without padding.
+template <typename T>
+inline void UpdateInterestDigestBytes(FSHA1& Digest, const T& Value)
+{
+	Digest.Update(reinterpret_cast<const uint8*>(&Value), sizeof(Value));
+}
+
+template <typename T>
+inline void UpdateInterestDigest(FSHA1& Digest, Schema_FieldId Id, const T& Value)
+{
+	UpdateInterestDigestBytes(Digest, Id);
+	UpdateInterestDigestBytes(Digest, Value);
+}
+
+inline void UpdateInterestDigest(FSHA1& Digest, Schema_FieldId Id, const Coordinates& Coords)
+{
+	UpdateInterestDigestBytes(Digest, Id);
+	UpdateInterestDigestBytes(Digest, Coords.X);
+	UpdateInterestDigestBytes(Digest, Coords.Y);
+	UpdateInterestDigestBytes(Digest, Coords.Z);
+}
+
+inline void UpdateQueryConstraintDigest(FSHA1& Digest, Schema_FieldId Id, const QueryConstraint& Constraint)
+{
+	UpdateInterestDigestBytes(Digest, Id);
+
+	if (Constraint.SphereConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 1, Constraint.SphereConstraint->Center);
+		UpdateInterestDigestBytes(Digest, Constraint.SphereConstraint->Radius);
+	}
+
+	if (Constraint.CylinderConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 2, Constraint.CylinderConstraint->Center);
+		UpdateInterestDigestBytes(Digest, Constraint.CylinderConstraint->Radius);
+	}
+
+	if (Constraint.BoxConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 3, Constraint.BoxConstraint->Center);
+		UpdateInterestDigest(Digest, 3, Constraint.BoxConstraint->EdgeLength);
+	}
+
+	if (Constraint.RelativeSphereConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 4, Constraint.RelativeSphereConstraint->Radius);
+	}
+
+	if (Constraint.RelativeCylinderConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 5, Constraint.RelativeCylinderConstraint->Radius);
+	}
+
+	if (Constraint.RelativeBoxConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 6, Constraint.RelativeBoxConstraint->EdgeLength);
+	}
+
+	if (Constraint.EntityIdConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 7, *Constraint.EntityIdConstraint);
+	}
+
+	if (Constraint.ComponentConstraint.IsSet())
+	{
+		UpdateInterestDigest(Digest, 8, *Constraint.ComponentConstraint);
+	}
+
+	for (const QueryConstraint& AndConstraintEntry : Constraint.AndConstraint)
+	{
+		UpdateQueryConstraintDigest(Digest, 9, AndConstraintEntry);
+	}
+
+	for (const QueryConstraint& OrConstraintEntry : Constraint.OrConstraint)
+	{
+		UpdateQueryConstraintDigest(Digest, 10, OrConstraintEntry);
+	}
+
+	UpdateInterestDigestBytes(Digest, InterestDigestObjectEnd);
+}
+
+inline void UpdateQueryDigest(FSHA1& Digest, Schema_FieldId Id, const Query& Query)
+{
+	UpdateInterestDigestBytes(Digest, Id);
+
+	UpdateQueryConstraintDigest(Digest, 1, Query.Constraint);
+
+	if (Query.FullSnapshotResult.IsSet())
+	{
+		UpdateInterestDigest(Digest, 2, static_cast<uint8>(*Query.FullSnapshotResult ? 1 : 0));
+	}
+
+	for (uint32 ComponentId : Query.ResultComponentId)
+	{
+		UpdateInterestDigest(Digest, 3, ComponentId);
+	}
+
+	if (Query.Frequency.IsSet())
+	{
+		UpdateInterestDigest(Digest, 4, *Query.Frequency);
+	}
+
+	UpdateInterestDigestBytes(Digest, InterestDigestObjectEnd);
+}
+
 inline QueryConstraint IndexQueryConstraintFromSchema(Schema_Object* Object, Schema_FieldId Id, uint32 Index)
 {
 	QueryConstraint NewQueryConstraint;
@@ -467,6 +585,27 @@ struct Interest : Component
 		return ComponentUpdate;
 	}
 
+	// Matches for two Interest components which would be serialized the same.
+	FSHAHash GetDigest() const
+	{
+		FSHA1 Digest;
+
+		for (const auto& KVPair : ComponentInterestMap)
+		{
+			UpdateInterestDigest(Digest, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
+			for (const Query& QueryEntry : KVPair.Value.Queries)
+			{
+				UpdateQueryDigest(Digest, SCHEMA_MAP_VALUE_FIELD_ID, QueryEntry);
+			}
+		}
+
+		Digest.Final();
+
+		FSHAHash Hash;
+		Digest.GetHash(Hash.Hash);
+		return Hash;
+	}
+
 	void FillComponentData(Schema_Object* InterestComponentObject)
 	{
 		for (const auto& KVPair : ComponentInterestMap)
@@ -480,4 +619,29 @@ struct Interest : Component
 	TMap<uint32, ComponentInterest> ComponentInterestMap;
 };
 
+// The Interest last sent for an entity, so updates which wouldn't change it can be skipped.
+// Only its digest is kept, rather than a copy of the Interest for every entity.
+struct LastSentInterest
+{
+	FSHAHash Digest;
+	bool bIsSet = false;
+
+	bool Matches(const FSHAHash& NewDigest) const
+	{
+		return bIsSet && Digest == NewDigest;
+	}
+
+	void Set(const FSHAHash& NewDigest)
+	{
+		Digest = NewDigest;
+		bIsSet = true;
+	}
+
+	// Called when another worker may have written the Interest, so the next update is always sent.
+	void Reset()
+	{
+		bIsSet = false;
+	}
+};
+
 } // namespace SpatialGDK
@@ -156,6 +156,46 @@ struct EntityAcl : Component
 		return ComponentUpdate;
 	}
 
+	// Only sends the component write ACL, leaving the read ACL unchanged.
+	Worker_ComponentUpdate CreateComponentWriteAclUpdate()
+	{
+		Worker_ComponentUpdate ComponentUpdate = {};
+		ComponentUpdate.component_id = ComponentId;
+		ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
+
+		for (const auto& KVPair : ComponentWriteAcl)
+		{
+			Schema_Object* KVPairObject = Schema_AddObject(ComponentObject, 2);
+			Schema_AddUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID, KVPair.Key);
+			AddWorkerRequirementSetToSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID, KVPair.Value);
+		}
+
+		return ComponentUpdate;
+	}
+
+	// Moves write authority over every component the worker authoritative over Position has, except the EntityACL itself, to
+	// AuthoritativeWorkerRequirementSet. Components owned by a client keep their write ACL. Returns false if nothing changed.
+	bool SetWorkerTypeAuthority(const WorkerRequirementSet& AuthoritativeWorkerRequirementSet)
+	{
+		const WorkerRequirementSet* CurrentRequirementSet = ComponentWriteAcl.Find(SpatialConstants::POSITION_COMPONENT_ID);
+		if (CurrentRequirementSet == nullptr || *CurrentRequirementSet == AuthoritativeWorkerRequirementSet)
+		{
+			return false;
+		}
+
+		const WorkerRequirementSet PreviousRequirementSet = *CurrentRequirementSet;
+		for (auto& ComponentWriteAclPair : ComponentWriteAcl)
+		{
+			if (ComponentWriteAclPair.Key != SpatialConstants::ENTITY_ACL_COMPONENT_ID && ComponentWriteAclPair.Value == PreviousRequirementSet)
+			{
+				ComponentWriteAclPair.Value = AuthoritativeWorkerRequirementSet;
+			}
+		}
+
+		return true;
+	}
+
 	WorkerRequirementSet ReadAcl;
 	WriteAclMap ComponentWriteAcl;
 };
@@ -109,20 +109,21 @@ struct UnrealMetadata : Component
 
 FORCEINLINE SubobjectToOffsetMap CreateOffsetMapFromActor(AActor* Actor, const FClassInfo& Info)
 {
-	SubobjectToOffsetMap SubobjectNameToOffset;
+	SubobjectToOffsetMap SubobjectToOffset;
+	SubobjectToOffset.Reserve(Info.SubobjectNameToOffset.Num());
 
-	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
+	// Match the Actor's direct subobjects against its class's default subobjects in a single pass,
+	// rather than searching the object hash for each of them by name.
+	ForEachObjectWithOuter(Actor, [&Info, &SubobjectToOffset](UObject* Subobject)
 	{
-		UObject* Subobject = StaticFindObjectFast(UObject::StaticClass(), Actor, SubobjectInfoPair.Value->SubobjectName);
-		uint32 Offset = SubobjectInfoPair.Key;
-
-		if (Subobject != nullptr && Subobject->IsPendingKill() == false && Subobject->IsSupportedForNetworking())
+		const uint32* Offset = Info.SubobjectNameToOffset.Find(Subobject->GetFName());
+		if (Offset != nullptr && Subobject->IsSupportedForNetworking())
 		{
-			SubobjectNameToOffset.Add(Subobject, Offset);
+			SubobjectToOffset.Add(Subobject, *Offset);
 		}
-	}
+	}, false /*bIncludeNestedObjects*/, RF_NoFlags, EInternalObjectFlags::PendingKill);
 
-	return SubobjectNameToOffset;
+	return SubobjectToOffset;
 }
 
 } // namespace SpatialGDK
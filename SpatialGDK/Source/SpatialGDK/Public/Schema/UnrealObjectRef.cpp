@@ -2,5 +2,63 @@
 
 #include "Schema/UnrealObjectRef.h"
 
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+// The parts of a ref that make up its chain: the Path, and the Outer by its entity, offset and own chain.
+struct FObjectRefChainKey
+{
+	bool bHasPath;
+	FName Path;
+	bool bHasOuter;
+	Worker_EntityId OuterEntity;
+	uint32 OuterOffset;
+	uint32 OuterChainId;
+
+	bool operator==(const FObjectRefChainKey& Other) const
+	{
+		return bHasPath == Other.bHasPath && Path == Other.Path && bHasOuter == Other.bHasOuter &&
+			OuterEntity == Other.OuterEntity && OuterOffset == Other.OuterOffset && OuterChainId == Other.OuterChainId;
+	}
+};
+
+uint32 GetTypeHash(const FObjectRefChainKey& Key)
+{
+	uint32 Result = HashCombine(GetTypeHash(Key.bHasPath), GetTypeHash(Key.Path));
+	Result = HashCombine(Result, GetTypeHash(Key.bHasOuter));
+	Result = HashCombine(Result, GetTypeHash(static_cast<int64>(Key.OuterEntity)));
+	Result = HashCombine(Result, GetTypeHash(Key.OuterOffset));
+	return HashCombine(Result, Key.OuterChainId);
+}
+
+// Chains are never removed, there is one per distinct static object path and stably named subobject.
+FCriticalSection ChainIdsCriticalSection;
+TMap<FObjectRefChainKey, uint32> ChainIds;
+}
+
 const FUnrealObjectRef FUnrealObjectRef::NULL_OBJECT_REF = FUnrealObjectRef(0, 0);
 const FUnrealObjectRef FUnrealObjectRef::UNRESOLVED_OBJECT_REF = FUnrealObjectRef(0, 1);
+
+uint32 FUnrealObjectRef::InternChain(const SpatialGDK::TSchemaOption<FName>& Path, const SpatialGDK::TSchemaOption<FUnrealObjectRef>& Outer)
+{
+	FObjectRefChainKey Key;
+	Key.bHasPath = Path.IsSet();
+	Key.Path = Path.IsSet() ? *Path : NAME_None;
+	Key.bHasOuter = Outer.IsSet();
+	Key.OuterEntity = Outer.IsSet() ? Outer->Entity : 0;
+	Key.OuterOffset = Outer.IsSet() ? Outer->Offset : 0;
+	Key.OuterChainId = Outer.IsSet() ? Outer->ChainId : 0;
+
+	FScopeLock Lock(&ChainIdsCriticalSection);
+
+	if (const uint32* ChainId = ChainIds.Find(Key))
+	{
+		return *ChainId;
+	}
+
+	// 0 is reserved for refs without a Path or Outer.
+	const uint32 NewChainId = ChainIds.Num() + 1;
+	ChainIds.Add(Key, NewChainId);
+	return NewChainId;
+}
@@ -2,6 +2,7 @@
 
 #include "Containers/UnrealString.h"
 #include "Templates/TypeHash.h"
+#include "UObject/NameTypes.h"
 
 #include "Utils/SchemaOption.h"
 
@@ -18,13 +19,15 @@ struct FUnrealObjectRef
 		, Offset(Offset)
 	{}
 
-	FUnrealObjectRef(Worker_EntityId Entity, uint32 Offset, FString Path, FUnrealObjectRef Outer, bool bNoLoadOnClient = false)
+	FUnrealObjectRef(Worker_EntityId Entity, uint32 Offset, FName Path, FUnrealObjectRef Outer, bool bNoLoadOnClient = false)
 		: Entity(Entity)
 		, Offset(Offset)
 		, Path(Path)
 		, Outer(Outer)
 		, bNoLoadOnClient(bNoLoadOnClient)
-	{}
+	{
+		UpdateChainId();
+	}
 
 	FUnrealObjectRef(const FUnrealObjectRef& In)
 		: Entity(In.Entity)
@@ -32,6 +35,7 @@ struct FUnrealObjectRef
 		, Path(In.Path)
 		, Outer(In.Outer)
 		, bNoLoadOnClient(In.bNoLoadOnClient)
+		, ChainId(In.ChainId)
 	{}
 
 	FORCEINLINE FUnrealObjectRef& operator=(const FUnrealObjectRef& In)
@@ -41,6 +45,7 @@ struct FUnrealObjectRef
 		Path = In.Path;
 		Outer = In.Outer;
 		bNoLoadOnClient = In.bNoLoadOnClient;
+		ChainId = In.ChainId;
 		return *this;
 	}
 
@@ -51,7 +56,7 @@ struct FUnrealObjectRef
 
 	FORCEINLINE FUnrealObjectRef GetLevelReference() const
 	{
-		if (Path->Equals(TEXT("PersistentLevel")))
+		if (Path.IsSet() && *Path == NAME_PersistentLevel)
 		{
 			return *this;
 		}
@@ -68,10 +73,10 @@ struct FUnrealObjectRef
 
 	FORCEINLINE bool operator==(const FUnrealObjectRef& Other) const
 	{
+		// Equal chain IDs mean equal paths and outers, so the outer chain doesn't need to be walked.
 		return Entity == Other.Entity &&
 			Offset == Other.Offset &&
-			((!Path && !Other.Path) || (Path && Other.Path && Path->Equals(*Other.Path))) &&
-			((!Outer && !Other.Outer) || (Outer && Other.Outer && *Outer == *Other.Outer));
+			ChainId == Other.ChainId;
 		// Intentionally don't compare bNoLoadOnClient since it does not affect equality.
 	}
 
@@ -85,14 +90,28 @@ struct FUnrealObjectRef
 		return (*this != NULL_OBJECT_REF && *this != UNRESOLVED_OBJECT_REF);
 	}
 
+	// Must be called after changing Path or Outer directly, once any change to the Outer's own chain has been made.
+	FORCEINLINE void UpdateChainId()
+	{
+		ChainId = (Path.IsSet() || Outer.IsSet()) ? InternChain(Path, Outer) : 0;
+	}
+
 	static const FUnrealObjectRef NULL_OBJECT_REF;
 	static const FUnrealObjectRef UNRESOLVED_OBJECT_REF;
 
 	Worker_EntityId Entity;
 	uint32 Offset;
-	SpatialGDK::TSchemaOption<FString> Path;
+	// Paths are interned as names, so comparing and hashing them doesn't touch the string.
+	// They are still sent as strings, see AddObjectRefToSchema and FSpatialNetBitWriter::SerializeObjectRef.
+	SpatialGDK::TSchemaOption<FName> Path;
 	SpatialGDK::TSchemaOption<FUnrealObjectRef> Outer;
 	bool bNoLoadOnClient = false;
+
+	// Interned ID of the Path and Outer chain, 0 when neither is set. Refs share an ID exactly when their Path and Outer are equal.
+	uint32 ChainId = 0;
+
+private:
+	static SPATIALGDK_API uint32 InternChain(const SpatialGDK::TSchemaOption<FName>& Path, const SpatialGDK::TSchemaOption<FUnrealObjectRef>& Outer);
 };
 
 inline uint32 GetTypeHash(const FUnrealObjectRef& ObjectRef)
@@ -100,8 +119,7 @@ inline uint32 GetTypeHash(const FUnrealObjectRef& ObjectRef)
 	uint32 Result = 1327u;
 	Result = (Result * 977u) + GetTypeHash(static_cast<int64>(ObjectRef.Entity));
 	Result = (Result * 977u) + GetTypeHash(ObjectRef.Offset);
-	Result = (Result * 977u) + GetTypeHash(ObjectRef.Path);
-	Result = (Result * 977u) + GetTypeHash(ObjectRef.Outer);
+	Result = (Result * 977u) + ObjectRef.ChainId;
 	// Intentionally don't hash bNoLoadOnClient.
 	return Result;
 }
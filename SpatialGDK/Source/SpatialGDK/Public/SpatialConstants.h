@@ -114,6 +114,7 @@ namespace SpatialConstants
 	const Worker_ComponentId RPCS_ON_ENTITY_CREATION_ID						= 9985;
 	const Worker_ComponentId DEBUG_METRICS_COMPONENT_ID						= 9984;
 	const Worker_ComponentId ALWAYS_RELEVANT_COMPONENT_ID					= 9983;
+	const Worker_ComponentId ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID			= 9982;
 
 	const Worker_ComponentId STARTING_GENERATED_COMPONENT_ID				= 10000;
 
@@ -124,6 +125,12 @@ namespace SpatialConstants
 
 	const Schema_FieldId STARTUP_ACTOR_MANAGER_CAN_BEGIN_PLAY_ID			= 1;
 
+	const Schema_FieldId ACTOR_GROUP_ASSIGNMENTS_OFFLOADED_ACTOR_GROUP_TO_WORKER_TYPE_ID	= 1;
+	const Schema_FieldId ACTOR_GROUP_ASSIGNMENTS_REPORT_WORKER_LOAD_COMMAND_ID	= 1;
+	const Schema_FieldId REPORT_WORKER_LOAD_WORKER_TYPE_ID					= 1;
+	const Schema_FieldId REPORT_WORKER_LOAD_LOAD_ID							= 2;
+	const Schema_FieldId REPORT_WORKER_LOAD_OWNED_ACTOR_GROUPS_ID			= 3;
+
 	const Schema_FieldId ACTOR_COMPONENT_REPLICATES_ID                      = 1;
 	const Schema_FieldId ACTOR_TEAROFF_ID									= 3;
 
@@ -162,6 +169,9 @@ namespace SpatialConstants
 	// Reserved entity IDs expire in 5 minutes, we will refresh them every 3 minutes to be safe.
 	const float ENTITY_RANGE_EXPIRATION_INTERVAL_SECONDS = 180.0f;
 
+	// How often the entity pool samples the rate entity IDs are used at, to decide how many to keep reserved.
+	const float ENTITY_POOL_CONSUMPTION_SAMPLE_INTERVAL_SECONDS = 0.5f;
+
 	const float FIRST_COMMAND_RETRY_WAIT_SECONDS = 0.2f;
 	const uint32 MAX_NUMBER_COMMAND_ATTEMPTS = 5u;
 
@@ -197,6 +207,12 @@ namespace SpatialConstants
 	const Worker_ComponentId MAX_EXTERNAL_SCHEMA_ID = 2000;
 
 	const FString SPATIALOS_METRICS_DYNAMIC_FPS = TEXT("Dynamic.FPS");
+	const FString SPATIALOS_METRICS_REPLICATION_BUDGET_MS = TEXT("Replication.BudgetMs");
+	const FString SPATIALOS_METRICS_SERVER_REPLICATE_ACTORS_MS = TEXT("Replication.ServerReplicateActorsMs");
+	const FString SPATIALOS_METRICS_QUEUED_OUTGOING_MESSAGES = TEXT("Replication.QueuedOutgoingMessages");
+	const FString SPATIALOS_METRICS_DEFERRED_ACTORS = TEXT("Replication.DeferredActors");
+	const FString SPATIALOS_METRICS_ENTITY_POOL_REMAINING_IDS = TEXT("EntityPool.RemainingIds");
+	const FString SPATIALOS_METRICS_ENTITY_POOL_STARVED_ALLOCATIONS = TEXT("EntityPool.StarvedAllocations");
 
 	const FString LOCATOR_HOST = TEXT("locator.improbable.io");
 	const uint16 LOCATOR_PORT = 444;
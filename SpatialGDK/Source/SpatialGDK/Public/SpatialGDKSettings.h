@@ -9,6 +9,43 @@
 
 #include "SpatialGDKSettings.generated.h"
 
+USTRUCT()
+struct FClientInterestBand
+{
+	GENERATED_BODY()
+
+	FClientInterestBand()
+		: Radius(5000.0f)
+		, bFullSnapshot(true)
+		, MaxFrequency(0.0f)
+	{
+	}
+
+	/** Radius, in centimeters, around the player's Actors within which other Actors are in this band. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float Radius;
+
+	/** If set, the band only applies to Actors of this class and its derived classes. Otherwise it applies to every Actor. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK")
+	TSubclassOf<AActor> ActorClass;
+
+	/**
+	* Whether every component of the Actors in this band is received. Otherwise only their position, the components needed to spawn them and ResultComponentIds are.
+	* When an Actor moves from a band receiving its replicated properties into one which doesn't, those properties keep the last values received
+	* until it moves back, and USpatialNetDriver::IsActorReplicatedDataStale returns true for it in the meantime.
+	*/
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK")
+	bool bFullSnapshot;
+
+	/** Additional components received for the Actors in this band when bFullSnapshot is disabled. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (EditCondition = "!bFullSnapshot"))
+	TArray<uint32> ResultComponentIds;
+
+	/** Maximum frequency, in Hz, of updates for the Actors in this band. 0 means updates are received as soon as possible. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK", meta = (ClampMin = "0.0"))
+	float MaxFrequency;
+};
+
 UCLASS(config = SpatialGDKSettings, defaultconfig)
 class SPATIALGDK_API USpatialGDKSettings : public UObject
 {
@@ -43,6 +80,13 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (ConfigRestartRequired = false, DisplayName = "Refresh Count"))
 	uint32 EntityPoolRefreshCount;
 
+	/**
+	* The maximum number of entity ID reservation requests a server-worker instance can have in flight at once. When Actors are
+	* spawned faster than a single request can replenish the pool, the pool reserves ahead based on the rate entity IDs are used at.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (ConfigRestartRequired = false, DisplayName = "Max Pending Reservation Requests", ClampMin = "1"))
+	uint32 EntityPoolMaxPendingRequests;
+
 	/** Specifies the amount of time, in seconds, between heartbeat events sent from a game client to notify the server-worker instances that it's connected. */
 	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (ConfigRestartRequired = false, DisplayName = "Heartbeat Interval (seconds)"))
 	float HeartbeatIntervalSeconds;
@@ -72,6 +116,22 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum entities created per tick"))
 	uint32 EntityCreationRateLimit;
 
+	/**
+	* Specifies the maximum number of bytes of serialized component updates each server-worker instance sends per tick when replicating Actors.
+	* Once the limit is reached, the remaining Actors are replicated on later ticks, highest priority first.
+	* Default: `0` bytes per tick (no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum bytes replicated per tick"))
+	uint32 ActorReplicationByteLimit;
+
+	/**
+	* Specifies the maximum number of bytes of serialized component updates sent per tick when replicating Actors owned by a single client connection.
+	* Actors without an owning client connection are only limited by the per tick limit.
+	* Default: `0` bytes per tick (no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum bytes replicated per connection per tick"))
+	uint32 ActorReplicationByteLimitPerConnection;
+
 	/**
 	* Specifies the rate, in number of times per second, at which server-worker instance updates are sent to and received from the SpatialOS Runtime.
 	* Default:1000/s
@@ -79,6 +139,29 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "SpatialOS Network Update Rate"))
 	float OpsUpdateRate;
 
+	/**
+	* Adjust the time spent replicating Actors each tick so that replication stays within the target replication time.
+	* Actors that don't fit in the budget are deferred to a later tick, in priority order.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bEnableAdaptiveReplicationBudget;
+
+	/** Target time, in milliseconds, that server-worker instances spend replicating Actors each tick when the adaptive replication budget is enabled.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableAdaptiveReplicationBudget", DisplayName = "Target Replication Time (ms)"))
+	float TargetReplicationTimeMs;
+
+	/** Overrides the target replication time, in milliseconds, for specific server worker types.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableAdaptiveReplicationBudget", DisplayName = "Target Replication Time Per Worker Type (ms)"))
+	TMap<FName, float> WorkerTypeTargetReplicationTimeMs;
+
+	/** Number of messages waiting to be sent to the SpatialOS Runtime above which the replication budget is reduced. Set to 0 to ignore the queue.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableAdaptiveReplicationBudget"))
+	uint32 MaxQueuedOutgoingMessages;
+	/** Actors that haven't been replicated for this many seconds are replicated even if the replication budget has been spent. They are still subject to the byte limits.*/
+	/** Actors that haven't been replicated for this many seconds are replicated even if the replication budget has been spent.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableAdaptiveReplicationBudget", DisplayName = "Replication Starvation Time (seconds)"))
+	float ReplicationStarvationTime;
+
 	/** Replicate handover properties between servers, required for zoned worker deployments.*/
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	bool bEnableHandover;
@@ -87,6 +170,20 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	float MaxNetCullDistanceSquared;
 
+	/**
+	* Cull and prioritize Actors against client view targets using a uniform grid maintained from SpatialOS position updates.
+	* Actors further than MaxNetCullDistanceSquared (or their own NetCullDistanceSquared) from every view target are not replicated.
+	* They keep sending their SpatialOS position, but other server-workers see stale values for their other replicated properties until they are relevant again.
+	* Always relevant Actors, owner relevant Actors and Actors pending entity creation are unaffected.
+	* Only enable this when a single server-worker instance hosts all of the connected players.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bUseReplicationGrid;
+
+	/** Size, in centimeters, of a replication grid cell.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bUseReplicationGrid", ClampMin = "100.0"))
+	float ReplicationGridCellSize;
+
 	/** Seconds to wait before executing a received RPC substituting nullptr for unresolved UObjects*/
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Wait Time Before Processing Received RPC With Unresolved Refs"))
 	float QueuedIncomingRPCWaitTime;
@@ -95,6 +192,17 @@ public:
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bUsingQBI;
 
+	/**
+	* Distance bands for client interest, replacing the default checkout radius (AActor's NetCullDistanceSquared) when not empty.
+	* Each band adds a query delivering its components at up to its frequency for the Actors within its radius. Where bands overlap,
+	* clients receive the union of their components at the highest of their frequencies, so bands are usually listed from full data
+	* at a short radius to a few components at a low frequency further out. Actors beyond the largest radius of the bands that apply
+	* to them aren't checked out, so if every band has an ActorClass, Actors of other classes are only checked out as described below.
+	* Actor classes with a larger NetCullDistanceSquared, AlwaysInterested and always relevant Actors are still checked out in full.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Interest", meta = (ConfigRestartRequired = false))
+	TArray<FClientInterestBand> ClientInterestBands;
+
 	/** Frequency for updating an Actor's SpatialOS Position. Updating position should have a low update rate since it is expensive.*/
 	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (ConfigRestartRequired = false))
 	float PositionUpdateFrequency;
@@ -131,6 +239,36 @@ public:
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bBatchSpatialPositionUpdates;
 
+	/** EXPERIMENTAL - Maintain the replication consider list incrementally, only visiting Actors whose next net update is due, instead of walking every network Actor each tick.*/
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	bool bUsePersistentConsiderList;
+
+	/** Interval, in seconds, at which the persistent consider list is checked against the network object list for Actors that were not added to it.*/
+	UPROPERTY(config, meta = (ConfigRestartRequired = false))
+	float ConsiderListReconcileInterval;
+
+	/**
+	* Compare the replicated properties of the Actors about to be replicated in parallel on the task graph, before replicating them one by one.
+	* Serialization and sending of updates still happens on the game thread.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bParallelPropertyComparison;
+
+	/** Number of Actors whose properties are compared in parallel at a time, when the replication loop reaches the first of them. Fewer Actors left to replicate are left to the replication loop.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bParallelPropertyComparison"))
+	uint32 ParallelPropertyComparisonMinActors;
+
+	/**
+	* Build the class info of every class in the schema database that is already loaded once a map is loaded, rather than the first
+	* time each class is replicated. RPC and handover metadata is extracted on the task graph.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
+	bool bEnableClassInfoWarmUp;
+
+	/** Time, in milliseconds, spent warming up class info each tick, so it can overlap with level streaming.*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bEnableClassInfoWarmUp", ClampMin = "0.1"))
+	float ClassInfoWarmUpBudgetMs;
+
 	/** Maximum number of ActorComponents/Subobjects of the same class that can be attached to an Actor.*/
 	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (ConfigRestartRequired = false), DisplayName = "Maximum Dynamically Attached Subobjects Per Class")
 	uint32 MaxDynamicallyAttachedSubobjectsPerClass;
@@ -172,6 +310,25 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Offloading", meta = (EditCondition = "bEnableOffloading"))
 	TMap<FName, FActorGroupInfo> ActorGroups;
 
+	/** Hand Actor Groups with a LoadAwareOffloadWorkerType to that worker type while the server workers owning them are over LoadAwareOffloadingHighLoad, and take them back once they're under LoadAwareOffloadingLowLoad.
+	Every server worker reports the load from its SpatialOS metrics to the Global State Manager, so requires metrics to be enabled. The worker authoritative over it, of the default worker type, averages the loads of each worker type,
+	decides the reassignments and shares them with all server workers. The owning worker type keeps authority of the EntityACL, so Actor Groups with Actors owned by a client connection are kept on it, and taken back as soon as one becomes owned.
+	Requires regenerating snapshots. */
+	UPROPERTY(EditAnywhere, Config, Category = "Offloading", meta = (EditCondition = "bEnableOffloading"))
+	bool bEnableLoadAwareOffloading;
+
+	/** Average load of a worker type above which it offloads its next Actor Group. In the units of the reported load: frame time over target frame time, or seconds with bUseFrameTimeAsLoad. */
+	UPROPERTY(EditAnywhere, Config, Category = "Offloading", meta = (EditCondition = "bEnableLoadAwareOffloading", ClampMin = "0.0"))
+	float LoadAwareOffloadingHighLoad;
+
+	/** Average load of a worker type below which it takes back the Actor Group it offloaded last. Should be low enough that taking a group back doesn't push the load over LoadAwareOffloadingHighLoad. */
+	UPROPERTY(EditAnywhere, Config, Category = "Offloading", meta = (EditCondition = "bEnableLoadAwareOffloading", ClampMin = "0.0"))
+	float LoadAwareOffloadingLowLoad;
+
+	/** Minimum time between two Actor Group reassignments for load, so each shows in the load before the next. Taking back a group with owned Actors isn't delayed. */
+	UPROPERTY(EditAnywhere, Config, Category = "Offloading", meta = (EditCondition = "bEnableLoadAwareOffloading", ClampMin = "0.0"))
+	float LoadAwareOffloadingMinSecondsBetweenReassignments;
+
 	/** Available server worker types. */
 	UPROPERTY(Config)
 	TSet<FName> ServerWorkerTypes;
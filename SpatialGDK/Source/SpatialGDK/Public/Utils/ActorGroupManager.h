@@ -3,9 +3,14 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "SpatialConstants.h"
+#include "Utils/LoadAwareOffloadingPolicy.h"
 
 #include "ActorGroupManager.generated.h"
 
+class USpatialGDKSettings;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogActorGroupManager, Log, All)
+
 USTRUCT()
 struct FWorkerType
 {
@@ -39,12 +44,23 @@ struct FActorGroupInfo
 	/** The Actor classes contained within this group. Children of these classes will also be included. */	
 	UPROPERTY(EditAnywhere, Category = "SpatialGDK")
 	TSet<TSoftClassPtr<AActor>> ActorClasses;
+
+	/** With load-aware offloading enabled, the server worker type that takes authority of this group while its owning worker type is over budget. */
+	UPROPERTY(EditAnywhere, Category = "SpatialGDK")
+	FWorkerType LoadAwareOffloadWorkerType;
 	
 	FActorGroupInfo() : Name(NAME_None), OwningWorkerType()
 	{
 	}
 };
 
+// The actor group a class resolved to, and the index of the worker type that owns it.
+struct FActorGroupAssignment
+{
+	FName ActorGroup;
+	int32 WorkerTypeIndex;
+};
+
 UCLASS(Config=SpatialGDKSettings)
 class SPATIALGDK_API UActorGroupManager : public UObject
 {
@@ -53,12 +69,36 @@ class SPATIALGDK_API UActorGroupManager : public UObject
 private:
 	TMap<TSoftClassPtr<AActor>, FName> ClassPathToActorGroup;
 
-	TMap<FName, FName> ActorGroupToWorkerType;
+	// Actor groups resolved for each class queried so far, so the superclass chain and
+	// soft class paths are only walked once per class.
+	TMap<TWeakObjectPtr<UClass>, FActorGroupAssignment> ClassToActorGroupAssignment;
+
+	TMap<FName, int32> ActorGroupToWorkerTypeIndex;
+
+	// The worker types configured to own each actor group. These keep authority of the EntityACL of the group's
+	// entities when load-aware offloading moves the group to another worker type.
+	TMap<FName, int32> ActorGroupToHomeWorkerTypeIndex;
+
+	SpatialGDK::LoadAwareOffloadingPolicy LoadAwareOffloading;
+
+	// Worker types are referred to by their index in here, so they can be compared as integers.
+	// The default worker type is always at index 0.
+	TArray<FName> WorkerTypes;
 
 	FName DefaultWorkerType;
 
+	int32 FindOrAddWorkerTypeIndex(FName WorkerType);
+
+	void SetWorkerTypeIndexForActorGroup(FName ActorGroup, int32 WorkerTypeIndex);
+
 public:
 	void Init();
+	// Initializes from the given settings rather than the project's.
+	void Init(const USpatialGDKSettings& Settings);
+
+	// Returns the actor group this class (or a parent class) resolves to, and the index of the
+	// Server worker type authoritative over it. The result is cached per class.
+	FActorGroupAssignment GetActorGroupAssignmentForClass(TSubclassOf<AActor> Class);
 
 	// Returns the first ActorGroup that contains this, or a parent of this class,
 	// or the default actor group, if no mapping is found.
@@ -72,6 +112,37 @@ public:
 	// Returns the Server worker type that is authoritative over this ActorGroup.
 	FName GetWorkerTypeForActorGroup(const FName& ActorGroup) const;
 
+	// Returns the index of the Server worker type that is authoritative over this ActorGroup.
+	int32 GetWorkerTypeIndexForActorGroup(const FName& ActorGroup) const;
+
+	FName GetWorkerTypeByIndex(int32 WorkerTypeIndex) const { return WorkerTypes[WorkerTypeIndex]; }
+
+	// Returns the index of this worker type, or INDEX_NONE if it doesn't own any actor group.
+	int32 GetWorkerTypeIndex(FName WorkerType) const { return WorkerTypes.Find(WorkerType); }
+
+	// Returns the Server worker type configured to own this ActorGroup, which keeps authority of the EntityACL
+	// of its entities while load-aware offloading has moved the group to another worker type.
+	FName GetHomeWorkerTypeForActorGroup(const FName& ActorGroup) const;
+
+	bool IsLoadAwareOffloadingEnabled() const { return LoadAwareOffloading.HasGroups(); }
+
+	bool IsLoadAwareActorGroup(FName ActorGroup) const { return LoadAwareOffloading.IsLoadAwareActorGroup(ActorGroup); }
+
+	// Records the load reported by a server worker, and the load-aware actor groups with Actors it's authoritative over that are owned by a client.
+	// Only used on the worker deciding the reassignments.
+	void ReportWorkerLoad(const FString& WorkerId, FName WorkerType, double Load, const TArray<FString>& OwnedActorGroups, double Now);
+
+	// Returns the reassignments the load-aware offloading policy decides on from the reported loads. These aren't applied here:
+	// they're shared with all workers through the GlobalStateManager, which applies them with ApplyActorGroupAssignments.
+	TArray<SpatialGDK::ActorGroupReassignment> UpdateLoadAwareOffloading(double Now);
+
+	// Updates the offloaded actor groups stored on the GlobalStateManager with the given reassignments.
+	void AddReassignmentsToOffloadedActorGroups(const TArray<SpatialGDK::ActorGroupReassignment>& Reassignments, TMap<FString, FString>& InOutOffloadedActorGroupToWorkerType) const;
+
+	// Moves each actor group to the worker type it's offloaded to, or back to its owning worker type if it isn't in the map.
+	// Returns the actor groups whose worker type changed.
+	TArray<FName> ApplyActorGroupAssignments(const TMap<FString, FString>& OffloadedActorGroupToWorkerType);
+
 	// Returns true if ActorA and ActorB are contained in ActorGroups that are
 	// on the same Server worker type.
 	bool IsSameWorkerType(const AActor* ActorA, const AActor* ActorB);
@@ -0,0 +1,38 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Controls how much time ServerReplicateActors may spend calling ReplicateActor each tick.
+// The budget is the target replication time minus the time spent outside of the replication loop (building and sorting the consider list),
+// scaled down while the queue of messages waiting to be sent to the SpatialOS runtime is backed up.
+// The budget drops immediately when replication runs over and recovers gradually, to avoid oscillating between ticks.
+class SPATIALGDK_API FAdaptiveReplicationBudget
+{
+public:
+	FAdaptiveReplicationBudget();
+
+	void SetTargetTime(double InTargetTime);
+
+	// Called from the replication loop once it has finished.
+	void RecordReplicationLoop(double InReplicationLoopTime, int32 InNumDeferredActors);
+
+	// Called at the end of ServerReplicateActors to compute the budget for the next tick.
+	void Update(double InServerReplicateActorsTime, int32 InNumQueuedMessages, int32 MaxQueuedMessages);
+
+	double GetBudget() const { return Budget; }
+	double GetTargetTime() const { return TargetTime; }
+	double GetServerReplicateActorsTime() const { return ServerReplicateActorsTime; }
+	int32 GetNumQueuedMessages() const { return NumQueuedMessages; }
+	int32 GetNumDeferredActors() const { return NumDeferredActors; }
+
+private:
+	double TargetTime;
+	double Budget;
+
+	double ServerReplicateActorsTime;
+	double ReplicationLoopTime;
+	int32 NumQueuedMessages;
+	int32 NumDeferredActors;
+};
@@ -0,0 +1,55 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/Interest.h"
+
+class USchemaDatabase;
+
+namespace SpatialGDK
+{
+
+// The client interest distances of the Actor classes with a NetCullDistanceSquared larger than AActor's.
+// A class whose distance is no larger than that of one of its parent classes is already covered by the parent's query,
+// so only the classes that aren't covered are kept. Owned by the class info manager, so every net driver has its own table.
+class SPATIALGDK_API ClientInterestDistances
+{
+public:
+	// Builds the table from the loaded Actor classes in the schema database.
+	void Gather(const USchemaDatabase& SchemaDatabase);
+	// Builds the table from the given distances rather than from the class defaults.
+	void Gather(const TMap<UClass*, float>& InDiscoveredDistancesSquared);
+
+	// Updates the table for an Actor class loaded after it was gathered. Does nothing before the table is gathered, or for a class already considered.
+	void AddClass(UClass* Class);
+	// As above, with the given distance rather than the one from the class default.
+	void AddClass(UClass* Class, float DistanceSquared);
+
+	bool IsGathered() const { return bGathered; }
+
+	// The classes whose distance isn't covered by a parent class, with their distance.
+	const TMap<UClass*, float>& GetDistancesSquared() const { return DistancesSquared; }
+
+	// The constraints for the classes in the table, shared by every Actor. BuildConstraint is only called for each class the first time
+	// the constraints are needed after the table changed, and returns false if the class doesn't need a constraint.
+	const TArray<QueryConstraint>& GetClassConstraints(TFunctionRef<bool(UClass*, float, QueryConstraint&)> BuildConstraint);
+
+private:
+	void AddDiscoveredClass(UClass* Class, float DistanceSquared);
+	bool IsCoveredByParentClass(UClass* Class, float DistanceSquared) const;
+
+	TMap<UClass*, float> DistancesSquared;
+
+	// Every Actor class with a larger than default interest distance, including the ones already covered by a parent class.
+	TMap<UClass*, float> DiscoveredDistancesSquared;
+	// Every Actor class considered so far, so classes registered again with the class info manager are skipped.
+	TSet<UClass*> ProcessedClasses;
+	bool bGathered = false;
+
+	TArray<QueryConstraint> ClassConstraints;
+	bool bClassConstraintsDirty = true;
+};
+
+} // namespace SpatialGDK
@@ -40,8 +40,16 @@ public:
 		return bIsReady;
 	}
 
+	uint32 GetNumRemainingEntityIds() const { return NumRemainingEntityIds; }
+
+	// Number of times an entity ID was requested while the pool was empty.
+	uint32 GetNumStarvedAllocations() const { return NumStarvedAllocations; }
+
 private:
 	void OnEntityRangeExpired(uint32 ExpiringEntityRangeId);
+	void RecordConsumption();
+	void ReserveEntityIDsIfNeeded();
+	uint32 GetExpectedConsumptionDuringReservation() const;
 
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -53,7 +61,21 @@ private:
 	TArray<EntityRange> ReservedEntityIDRanges;
 
 	bool bIsReady;
-	bool bIsAwaitingResponse;
+
+	// Entity IDs left across all ranges, kept up to date rather than summed on every pop.
+	uint32 NumRemainingEntityIds;
+
+	// Reservation requests in flight, and the entity IDs they will add.
+	uint32 NumPendingRequests;
+	uint32 NumPendingEntityIds;
+
+	// Recent rate entity IDs are used at and time a reservation request takes, used to reserve ahead of demand.
+	double ConsumptionRate;
+	double ConsumptionSampleStartTime;
+	uint32 NumConsumedSinceSample;
+	double ReservationRoundTripSeconds;
+
+	uint32 NumStarvedAllocations;
 
 	uint32 NextEntityRangeId;
 };
@@ -0,0 +1,50 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FClassInfo;
+
+// Stores the handover shadow data for every object of one class.
+// Each object gets a fixed size slot laid out as described by FClassInfo::HandoverShadowSpans, and slots are allocated
+// from large chunks so the data for many objects is contiguous and doesn't need a heap allocation per object.
+// Chunks are never moved, so pointers returned by GetData stay valid until the slot is freed.
+class SPATIALGDK_API FHandoverShadowArena
+{
+public:
+	explicit FHandoverShadowArena(const FClassInfo& InClassInfo);
+	~FHandoverShadowArena();
+
+	// Returns a slot with every handover property initialized to its default value.
+	int32 Allocate();
+	void Free(int32 Slot);
+
+	uint8* GetData(int32 Slot) const
+	{
+		return Chunks[Slot / SlotsPerChunk] + (Slot % SlotsPerChunk) * SlotSize;
+	}
+
+private:
+	void InitializeSlot(uint8* Data) const;
+	void DestroySlot(uint8* Data) const;
+
+	static const int32 SlotsPerChunk = 64;
+
+	// Handover properties that need to be initialized and destroyed, i.e. the first element of every property that isn't memory comparable.
+	TArray<UProperty*> ComplexProperties;
+	TArray<int32> ComplexPropertyShadowOffsets;
+
+	int32 SlotSize;
+	TArray<uint8*> Chunks;
+	TArray<int32> FreeSlots;
+	TBitArray<> AllocatedSlots;
+};
+
+// A slot allocated from a FHandoverShadowArena. Keeps the arena alive until the slot is freed.
+struct FHandoverShadowData
+{
+	TSharedPtr<FHandoverShadowArena> Arena;
+	int32 Slot;
+	uint8* Data;
+};
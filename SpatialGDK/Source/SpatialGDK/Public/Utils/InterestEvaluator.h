@@ -0,0 +1,82 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/Interest.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogInterestEvaluator, Log, All);
+
+namespace SpatialGDK
+{
+
+// A component of an entity in an InterestEvaluator, with an estimate of the updates it sends.
+struct EvaluatedComponent
+{
+	float BytesPerUpdate;
+	float UpdatesPerSecond;
+};
+
+// An entity in an InterestEvaluator. Position is in SpatialOS coordinates (meters, Y up).
+struct EvaluatedEntity
+{
+	Coordinates Position;
+	TMap<Worker_ComponentId, EvaluatedComponent> Components;
+};
+
+struct InterestEvaluationResult
+{
+	// The components a worker would check out, for every entity it would check out.
+	TMap<Worker_EntityId_Key, TSet<Worker_ComponentId>> EntityComponents;
+
+	// Estimated updates per second the worker would receive for each of those components, taking the frequency limits of the queries into account.
+	TMap<TPair<Worker_EntityId_Key, Worker_ComponentId>, float> ComponentUpdatesPerSecond;
+
+	// Estimated bytes per second of component updates the worker would receive for those components.
+	double EstimatedBytesPerSecond = 0.0;
+
+	int32 GetNumComponents() const;
+};
+
+// Evaluates QueryConstraints and Interest components against a local set of entities, to see what a worker would check out
+// without a SpatialOS runtime. Follows the runtime's rules:
+//   - Cylinders are infinite along the Y axis, and boxes are axis aligned and centered on their center.
+//   - Relative constraints are centered on the position of the entity the Interest is on.
+//   - Queries on a component of the Interest only apply to the worker authoritative over that component.
+//   - Where several queries match the same entity component, the highest of their frequencies is used.
+class SPATIALGDK_API InterestEvaluator
+{
+public:
+	void AddEntity(Worker_EntityId EntityId, const EvaluatedEntity& Entity);
+	void RemoveEntity(Worker_EntityId EntityId);
+	void Reset();
+
+	const EvaluatedEntity* GetEntity(Worker_EntityId EntityId) const;
+	int32 GetNumEntities() const { return Entities.Num(); }
+
+	// Whether the entity matches the constraint, with relative constraints centered on RelativeTo.
+	bool Matches(const QueryConstraint& Constraint, Worker_EntityId EntityId, const Coordinates& RelativeTo) const;
+
+	// Evaluates the Interest component on InterestEntityId, for a worker authoritative over AuthoritativeComponentIds on that entity.
+	InterestEvaluationResult Evaluate(Worker_EntityId InterestEntityId, const Interest& InterestComponent, const TSet<Worker_ComponentId>& AuthoritativeComponentIds) const;
+
+	// Evaluates a set of queries, with relative constraints centered on the position of InterestEntityId.
+	InterestEvaluationResult Evaluate(Worker_EntityId InterestEntityId, const TArray<Query>& Queries) const;
+
+	// Adds the result of evaluating more queries, such as those of another entity the same worker is authoritative over.
+	// Components already in the result are received at the higher of the two rates.
+	void Evaluate(Worker_EntityId InterestEntityId, const TArray<Query>& Queries, InterestEvaluationResult& OutResult) const;
+
+	static void LogResult(const InterestEvaluationResult& Result, const TCHAR* Description);
+
+private:
+	bool Matches(const QueryConstraint& Constraint, Worker_EntityId EntityId, const EvaluatedEntity& Entity, const Coordinates& RelativeTo) const;
+
+	TMap<Worker_EntityId_Key, EvaluatedEntity> Entities;
+};
+
+} // namespace SpatialGDK
@@ -10,21 +10,25 @@
 class USpatialNetDriver;
 class USpatialPackageMapClient;
 class AActor;
+struct FClientInterestBand;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInterestFactory, Log, All);
 
 namespace SpatialGDK
 {
 
-void GatherClientInterestDistances();
-
 class SPATIALGDK_API InterestFactory
 {
 public:
 	InterestFactory(AActor* InActor, const FClassInfo& InInfo, USpatialNetDriver* InNetDriver);
 
-	Worker_ComponentData CreateInterestData() const;
-	Worker_ComponentUpdate CreateInterestUpdate() const;
+	// Records the digest of the created Interest in OutSentInterest, so later updates can be skipped if it hasn't changed.
+	Worker_ComponentData CreateInterestData(LastSentInterest& OutSentInterest) const;
+	// Returns false without creating an update if the Interest still matches InOutSentInterest.
+	bool CreateInterestUpdate(LastSentInterest& InOutSentInterest, Worker_ComponentUpdate& OutUpdate) const;
+
+	// The client query for a distance band. ActorTypeConstraint limits the band to the components of its ActorClass, and is ignored if not valid.
+	static Query CreateClientInterestBandQuery(const FClientInterestBand& Band, const QueryConstraint& ActorTypeConstraint, const QueryConstraint& LevelConstraints);
 
 private:
 	Interest CreateInterest() const;
@@ -35,12 +39,17 @@ private:
 	Interest CreatePlayerOwnedActorInterest() const;
 
 	void AddUserDefinedQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const;
+	// A query per distance band in ClientInterestBands, each with its own result components and frequency
+	void AddClientInterestBandQueries(const QueryConstraint& LevelConstraints, TArray<SpatialGDK::Query>& OutQueries) const;
+	// Leaves OutActorTypeConstraint invalid for bands without an ActorClass. Returns false if the band's ActorClass has no components to match.
+	bool CreateClientInterestBandTypeConstraint(const FClientInterestBand& Band, QueryConstraint& OutActorTypeConstraint) const;
 
 	// Checkout Constraint OR AlwaysInterested Constraint
-	QueryConstraint CreateSystemDefinedConstraints() const;
+	QueryConstraint CreateSystemDefinedConstraints(bool bIncludeDefaultCheckoutRadius) const;
 
 	// System Defined Constraints
-	QueryConstraint CreateCheckoutRadiusConstraints() const;
+	QueryConstraint CreateCheckoutRadiusConstraints(bool bIncludeDefaultRadius) const;
+	bool ShouldUseNetCullDistanceForCheckoutRadius() const;
 	QueryConstraint CreateAlwaysInterestedConstraint() const;
 	QueryConstraint CreateAlwaysRelevantConstraint() const;
 
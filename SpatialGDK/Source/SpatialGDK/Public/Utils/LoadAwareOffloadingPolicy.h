@@ -0,0 +1,78 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+// An actor group that can be handed from the worker type that owns it to an offload worker type.
+struct LoadAwareActorGroup
+{
+	FName ActorGroup;
+	int32 HomeWorkerTypeIndex;
+	int32 OffloadWorkerTypeIndex;
+};
+
+// A change of the worker type an actor group is assigned to.
+struct ActorGroupReassignment
+{
+	FName ActorGroup;
+	int32 WorkerTypeIndex;
+};
+
+// Decides which actor groups to offload from the worker type that owns them, based on the loads reported by server workers.
+// Worker types are referred to by their index in the actor group manager, and the load of a worker type is the average
+// of the latest load reported by each of its workers, as an actor group moves off every worker of its type at once.
+//   - While a home worker type is over HighLoad, its next group is offloaded, as long as the offload worker type's load
+//     is unknown or under LowLoad.
+//   - While a home worker type is under LowLoad, its most recently offloaded group is taken back.
+//   - At most one group is reassigned per MinSecondsBetweenReassignments, so the effect of a reassignment shows in the
+//     load before the next one.
+//   - Groups with Actors owned by a client connection are never offloaded, and are taken back straight away if a worker
+//     reports one while they're offloaded, as only the home worker type can update the EntityACL for a change of owner.
+// Groups are offloaded in the order they're given and taken back in reverse. Time is passed in, so the policy is deterministic.
+class SPATIALGDK_API LoadAwareOffloadingPolicy
+{
+public:
+	LoadAwareOffloadingPolicy() = default;
+	LoadAwareOffloadingPolicy(const TArray<LoadAwareActorGroup>& InGroups, float InHighLoad, float InLowLoad, float InMinSecondsBetweenReassignments, float InReportTimeoutSeconds);
+
+	// Replaces the previous report of WorkerId. Reports older than the report timeout are ignored, e.g. for workers which disconnected.
+	void ReportWorkerLoad(const FString& WorkerId, int32 WorkerTypeIndex, double Load, const TSet<FName>& OwnedActorGroups, double Now);
+
+	// Returns the reassignments to make at time Now, if any.
+	TArray<ActorGroupReassignment> Evaluate(double Now);
+
+	bool IsOffloaded(FName ActorGroup) const;
+	bool IsLoadAwareActorGroup(FName ActorGroup) const;
+
+	// Records whether a group is offloaded when that was decided elsewhere, e.g. by the worker previously making the decisions.
+	void SetOffloaded(FName ActorGroup, bool bOffloaded);
+	bool HasGroups() const { return Groups.Num() > 0; }
+
+private:
+	struct WorkerLoadReport
+	{
+		int32 WorkerTypeIndex;
+		double Load;
+		double Time;
+		TSet<FName> OwnedActorGroups;
+	};
+
+	bool TakeBackOwnedActorGroup(const TSet<FName>& OwnedActorGroups, TArray<ActorGroupReassignment>& OutReassignments) const;
+	bool ReassignForLoad(int32 HomeWorkerTypeIndex, const TMap<int32, double>& WorkerTypeLoads, const TSet<FName>& OwnedActorGroups, TArray<ActorGroupReassignment>& OutReassignments) const;
+
+	TArray<LoadAwareActorGroup> Groups;
+	TSet<FName> OffloadedGroups;
+	TMap<FString, WorkerLoadReport> WorkerLoadReports;
+
+	float HighLoad = 1.0f;
+	float LowLoad = 0.0f;
+	float MinSecondsBetweenReassignments = 0.0f;
+	float ReportTimeoutSeconds = 0.0f;
+	double LastReassignmentTime = -DBL_MAX;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,48 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+// Schedules Actors to be considered for replication at their next net update time.
+// Actors are bucketed into fixed duration slots, and each tick only visits the slots that have elapsed since the previous tick,
+// so the cost of finding due Actors scales with the number of Actors that are due rather than the number of Actors scheduled.
+// Entries more than one revolution of the wheel in the future stay in their slot until the wheel comes around again.
+class SPATIALGDK_API FReplicationTimingWheel
+{
+public:
+	FReplicationTimingWheel(float InSlotDuration = 1.0f / 60.0f, int32 InNumSlots = 512);
+
+	// Schedules the Actor at Time, replacing any existing schedule for it.
+	void Schedule(AActor* Actor, float Time);
+	void Unschedule(const AActor* Actor);
+	bool IsScheduled(const AActor* Actor) const { return ActorToGeneration.Contains(Actor); }
+	int32 Num() const { return ActorToGeneration.Num(); }
+
+	// Removes every Actor scheduled at or before CurrentTime and appends it to OutDueActors.
+	void PopDue(float CurrentTime, TArray<AActor*>& OutDueActors);
+
+	void Reset();
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		float Time;
+		uint32 Generation;
+	};
+
+	int64 GetTick(float Time) const;
+
+	float SlotDuration;
+	TArray<TArray<FEntry>> Slots;
+
+	// Last tick visited by PopDue. Entries scheduled in the past are placed in this slot.
+	int64 CurrentTick;
+
+	// Rescheduling an Actor bumps its generation instead of searching the slots, entries with an older generation are discarded when visited.
+	TMap<TWeakObjectPtr<AActor>, uint32> ActorToGeneration;
+	uint32 NextGeneration;
+};
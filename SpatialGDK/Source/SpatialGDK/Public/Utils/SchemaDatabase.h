@@ -72,6 +72,92 @@ struct FSubobjectSchemaData
 	}
 };
 
+// The schema database in the form used at runtime: every class path stored once in a sorted array, with the schema data
+// for each class in flat arrays next to it, so lookups binary search rather than hash full class path strings.
+// It's built from the maps in USchemaDatabase when the asset is saved, and serialized as a single untagged blob,
+// so loading it skips the tagged property serialization and hashing the maps go through.
+class SPATIALGDK_API FCompactSchemaDatabase
+{
+public:
+	void Build(const TMap<FString, FActorSchemaData>& ActorClassPathToSchema, const TMap<FString, FSubobjectSchemaData>& SubobjectClassPathToSchema,
+		const TMap<FString, uint32>& LevelPathToComponentId, const TMap<uint32, FString>& ComponentIdToClassPath, const TSet<uint32>& InLevelComponentIds);
+	void Serialize(FArchive& Ar);
+
+	const FActorSchemaData* FindActorSchemaData(const FString& ClassPath) const;
+	const FSubobjectSchemaData* FindSubobjectSchemaData(const FString& ClassPath) const;
+	const FString* FindClassPathForComponentId(Worker_ComponentId ComponentId) const;
+	Worker_ComponentId GetComponentIdForLevelPath(const FString& LevelPath) const;
+	bool IsLevelComponent(Worker_ComponentId ComponentId) const;
+
+	int32 GetNumActorClasses() const { return ActorSchemas.Num(); }
+	int32 GetNumSubobjectClasses() const { return SubobjectSchemas.Num(); }
+
+	template <typename Func>
+	void ForEachActorClassPath(Func&& Function) const
+	{
+		for (int32 Index = 0; Index < ClassPaths.Num(); Index++)
+		{
+			if (ActorSchemaIndices[Index] != INDEX_NONE)
+			{
+				Function(ClassPaths[Index]);
+			}
+		}
+	}
+
+	template <typename Func>
+	void ForEachSubobjectClassPath(Func&& Function) const
+	{
+		for (int32 Index = 0; Index < ClassPaths.Num(); Index++)
+		{
+			if (SubobjectSchemaIndices[Index] != INDEX_NONE)
+			{
+				Function(ClassPaths[Index]);
+			}
+		}
+	}
+
+	// Calls Function with each generated component ID and the index of the path of the class it was generated for.
+	template <typename Func>
+	void ForEachComponentIdClassPathIndex(Func&& Function) const
+	{
+		for (int32 Index = 0; Index < ComponentIds.Num(); Index++)
+		{
+			Function(ComponentIds[Index], ComponentClassPathIndices[Index]);
+		}
+	}
+
+	const FString& GetClassPath(int32 ClassPathIndex) const { return ClassPaths[ClassPathIndex]; }
+
+	// Changes every time the database is rebuilt, which invalidates class path indices.
+	uint32 GetBuildGeneration() const { return BuildGeneration; }
+
+private:
+	int32 FindClassPathIndex(const FString& ClassPath) const;
+
+	// Actor and Subobject class paths, sorted.
+	TArray<FString> ClassPaths;
+
+	// Parallel to ClassPaths: the index of the class's entry in ActorSchemas or SubobjectSchemas, or INDEX_NONE.
+	TArray<int32> ActorSchemaIndices;
+	TArray<int32> SubobjectSchemaIndices;
+
+	TArray<FActorSchemaData> ActorSchemas;
+	TArray<FSubobjectSchemaData> SubobjectSchemas;
+
+	// Sorted, with the index in ClassPaths of the class each component ID was generated for.
+	TArray<Worker_ComponentId> ComponentIds;
+	TArray<int32> ComponentClassPathIndices;
+
+	// Sorted, with the component ID generated for each level.
+	TArray<FString> LevelPaths;
+	TArray<Worker_ComponentId> LevelPathComponentIds;
+
+	// Sorted.
+	TArray<Worker_ComponentId> LevelComponentIds;
+
+	uint32 BuildGeneration = 0;
+};
+
 UCLASS()
 class SPATIALGDK_API USchemaDatabase : public UDataAsset
 {
@@ -81,6 +167,20 @@ public:
 
 	USchemaDatabase() : NextAvailableComponentId(SpatialConstants::STARTING_GENERATED_COMPONENT_ID) {}
 
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+#endif
+
+	// Rebuilds the compact schema database from the maps. Call after changing them.
+	void BuildCompactSchemaDatabase();
+
+	const FCompactSchemaDatabase& GetCompactSchemaDatabase() const { return CompactSchemaDatabase; }
+
+	// The maps are the editable form of the schema database, used by schema generation. They aren't cooked;
+	// at runtime the schema database is read through GetCompactSchemaDatabase.
+#if WITH_EDITORONLY_DATA
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TMap<FString, FActorSchemaData> ActorClassPathToSchema;
 
@@ -95,8 +195,11 @@ public:
 
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TSet<uint32> LevelComponentIds;
+#endif
 
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	uint32 NextAvailableComponentId;
-};
 
+private:
+	FCompactSchemaDatabase CompactSchemaDatabase;
+};
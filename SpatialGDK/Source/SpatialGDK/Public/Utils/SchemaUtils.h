@@ -12,6 +12,7 @@
 #include <WorkerSDK/improbable/c_worker.h>
 
 using StringToEntityMap = TMap<FString, Worker_EntityId>;
+using StringToStringMap = TMap<FString, FString>;
 
 namespace SpatialGDK
 {
@@ -115,7 +116,7 @@ inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const
 	Schema_AddUint32(ObjectRefObject, 2, ObjectRef.Offset);
 	if (ObjectRef.Path)
 	{
-		AddStringToSchema(ObjectRefObject, 3, *ObjectRef.Path);
+		AddStringToSchema(ObjectRefObject, 3, ObjectRef.Path->ToString());
 		Schema_AddBool(ObjectRefObject, 4, ObjectRef.bNoLoadOnClient);
 	}
 	if (ObjectRef.Outer)
@@ -136,7 +137,7 @@ inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_F
 	ObjectRef.Offset = Schema_GetUint32(ObjectRefObject, 2);
 	if (Schema_GetObjectCount(ObjectRefObject, 3) > 0)
 	{
-		ObjectRef.Path = GetStringFromSchema(ObjectRefObject, 3);
+		ObjectRef.Path = FName(*GetStringFromSchema(ObjectRefObject, 3));
 	}
 	if (Schema_GetBoolCount(ObjectRefObject, 4) > 0)
 	{
@@ -146,6 +147,7 @@ inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_F
 	{
 		ObjectRef.Outer = GetObjectRefFromSchema(ObjectRefObject, 5);
 	}
+	ObjectRef.UpdateChainId();
 
 	return ObjectRef;
 }
@@ -183,6 +185,31 @@ inline StringToEntityMap GetStringToEntityMapFromSchema(Schema_Object* Object, S
 	return Map;
 }
 
+inline void AddStringToStringMapToSchema(Schema_Object* Object, Schema_FieldId Id, const StringToStringMap& Map)
+{
+	for (const auto& Pair : Map)
+	{
+		Schema_Object* PairObject = Schema_AddObject(Object, Id);
+		AddStringToSchema(PairObject, SCHEMA_MAP_KEY_FIELD_ID, Pair.Key);
+		AddStringToSchema(PairObject, SCHEMA_MAP_VALUE_FIELD_ID, Pair.Value);
+	}
+}
+
+inline StringToStringMap GetStringToStringMapFromSchema(Schema_Object* Object, Schema_FieldId Id)
+{
+	StringToStringMap Map;
+
+	int32 MapCount = (int32)Schema_GetObjectCount(Object, Id);
+	for (int32 i = 0; i < MapCount; i++)
+	{
+		Schema_Object* PairObject = Schema_IndexObject(Object, Id, i);
+
+		Map.Add(GetStringFromSchema(PairObject, SCHEMA_MAP_KEY_FIELD_ID), GetStringFromSchema(PairObject, SCHEMA_MAP_VALUE_FIELD_ID));
+	}
+
+	return Map;
+}
+
 inline void AddRotatorToSchema(Schema_Object* Object, Schema_FieldId Id, FRotator Rotator)
 {
 	Schema_Object* RotatorObject = Schema_AddObject(Object, Id);
@@ -236,6 +263,20 @@ inline void DeepCopySchemaObject(Schema_Object* Source, Schema_Object* Target)
 	Schema_MergeFromBuffer(Target, Buffer, Length);
 }
 
+// Size in bytes of the serialized component data, used to account for the bandwidth used by replication.
+inline uint32 GetComponentDataSize(const Worker_ComponentData& Data)
+{
+	return Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Data.schema_type));
+}
+
+// Size in bytes of the serialized component update, including events and cleared fields.
+inline uint32 GetComponentUpdateSize(const Worker_ComponentUpdate& Update)
+{
+	return Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update.schema_type))
+		+ Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update.schema_type))
+		+ Schema_GetComponentUpdateClearedFieldCount(Update.schema_type) * sizeof(Schema_FieldId);
+}
+
 inline Schema_ComponentData* DeepCopyComponentData(Schema_ComponentData* Source)
 {
 	Schema_ComponentData* Copy = Schema_CreateComponentData(Schema_GetComponentDataComponentId(Source));
@@ -0,0 +1,49 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+struct FNetViewer;
+
+// Uniform grid over the XY plane used by USpatialNetDriver to cull and prioritize replicated Actors against client view targets.
+// Actor cells are maintained incrementally from the SpatialOS position pipeline (USpatialActorChannel::SendPositionUpdates),
+// which culled Actors keep going through, and the cells covered by each viewer are rebuilt once per ServerReplicateActors.
+// Looking up which viewers can see an Actor is then a single map lookup rather than a walk over every viewer.
+class SPATIALGDK_API FSpatialActorGrid
+{
+public:
+	using FViewerIndices = TArray<int32, TInlineAllocator<4>>;
+
+	FSpatialActorGrid();
+
+	void SetCellSize(float InCellSize);
+
+	void UpdateActor(const AActor* Actor, const FVector& Location);
+	void RemoveActor(const AActor* Actor);
+	bool IsTracked(const AActor* Actor) const { return ActorToCell.Contains(Actor); }
+
+	// The location the Actor was last updated with, or nullptr if it isn't tracked.
+	const FVector* GetActorLocation(const AActor* Actor) const;
+
+	// Marks every cell within CullDistance of a viewer with the index of that viewer.
+	void UpdateViewers(const TArray<FNetViewer>& Viewers, float CullDistance);
+
+	// Returns the indices of the viewers whose cull distance covers the Actor's cell, or nullptr if none do.
+	const FViewerIndices* GetViewersForActor(const AActor* Actor) const;
+
+private:
+	FIntPoint GetCell(const FVector& Location) const;
+
+	struct FActorCell
+	{
+		FIntPoint Cell;
+		FVector Location;
+	};
+
+	float CellSize;
+
+	TMap<const AActor*, FActorCell> ActorToCell;
+	TMap<FIntPoint, FViewerIndices> CellToViewers;
+};
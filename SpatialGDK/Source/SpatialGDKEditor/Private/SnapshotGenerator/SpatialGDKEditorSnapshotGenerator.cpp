@@ -43,6 +43,13 @@ bool CreateSpawnerEntity(Worker_SnapshotOutputStream* OutputStream)
 
 	TArray<Worker_ComponentData> Components;
 
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	// Load-aware offloading is decided by the worker authoritative over the actor group assignments, which must be of the default
+	// worker type: the actor group manager treats it as a worker type that's always present.
+	const WorkerAttributeSet DefaultWorkerTypeAttributeSet{ { SpatialGDKSettings->DefaultWorkerType.WorkerTypeName.ToString() } };
+	const WorkerRequirementSet DefaultWorkerTypePermission{ DefaultWorkerTypeAttributeSet };
+
 	WriteAclMap ComponentWriteAcl;
 	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
 	ComponentWriteAcl.Add(SpatialConstants::METADATA_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
@@ -111,6 +118,14 @@ Worker_ComponentData CreateStartupActorManagerData()
 	return StartupActorManagerData;
 }
 
+Worker_ComponentData CreateActorGroupAssignmentsData()
+{
+	Worker_ComponentData ActorGroupAssignmentsData{};
+	ActorGroupAssignmentsData.component_id = SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID;
+	ActorGroupAssignmentsData.schema_type = Schema_CreateComponentData(SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID);
+	return ActorGroupAssignmentsData;
+}
+
 bool CreateGlobalStateManager(Worker_SnapshotOutputStream* OutputStream)
 {
 	Worker_Entity GSM;
@@ -127,6 +142,7 @@ bool CreateGlobalStateManager(Worker_SnapshotOutputStream* OutputStream)
 	ComponentWriteAcl.Add(SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
 	ComponentWriteAcl.Add(SpatialConstants::GSM_SHUTDOWN_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
 	ComponentWriteAcl.Add(SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID, SpatialConstants::UnrealServerPermission);
+	ComponentWriteAcl.Add(SpatialConstants::ACTOR_GROUP_ASSIGNMENTS_COMPONENT_ID, DefaultWorkerTypePermission);
 
 	Components.Add(Position(Origin).CreatePositionData());
 	Components.Add(Metadata(TEXT("GlobalStateManager")).CreateMetadataData());
@@ -135,8 +151,7 @@ bool CreateGlobalStateManager(Worker_SnapshotOutputStream* OutputStream)
 	Components.Add(CreateDeploymentData());
 	Components.Add(CreateGSMShutdownData());
 	Components.Add(CreateStartupActorManagerData());
-
-	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	Components.Add(CreateActorGroupAssignmentsData());
 
 	WorkerRequirementSet ReadACL;
 	for (const FName& WorkerType : SpatialGDKSettings->ServerWorkerTypes)